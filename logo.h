@@ -1,1038 +1,243 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : logo.png
-// Time generated : Wed, 25 Nov 20 01:44:47 +0100  (Server timezone: CET)
-// Image Size     : 215x76 pixels
-// Memory usage   : 32680 bytes
-
-
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
-
-const unsigned short OPERAME_LOGO[16340] PROGMEM={
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0060, 0x00C0, 0x0921, 0x09A1, 0x1202, 0x1262, 0x1AC3, 0x1B23, 0x23A4,   // 0x0040 (64) pixels
-0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x00C0, 0x0921, 0x09A1, 0x1202, 0x1262, 0x1AC3, 0x1B23, 0x23A4, 0x2404, 0x2404, 0x2404,   // 0x0110 (272) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0130 (304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0160 (352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0180 (384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0190 (400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01D0 (464) pixels
-0x0000, 0x0040, 0x00C0, 0x0921, 0x09A1, 0x1202, 0x1262, 0x1AC3, 0x1B23, 0x23A4, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x01E0 (480) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x0040, 0x0000,   // 0x01F0 (496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0210 (528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0220 (544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0230 (560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0250 (592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0280 (640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x00A0,   // 0x02A0 (672) pixels
-0x0901, 0x0981, 0x11E2, 0x1242, 0x1AA3, 0x1B03, 0x1B83, 0x23E4, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x02B0 (688) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x02C0 (704) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02D0 (720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02E0 (736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02F0 (752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0300 (768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0330 (816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0340 (832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x00C0, 0x0921, 0x09A1, 0x1202,   // 0x0370 (880) pixels
-0x1262, 0x1AC3, 0x1B43, 0x23A4, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x0380 (896) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x0390 (912) pixels
-0x2404, 0x3446, 0x4CA9, 0x652C, 0x7D8F, 0x9612, 0xAE75, 0xC6F8, 0x8DF1, 0x2404, 0x2404, 0x2404, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x03A0 (928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03B0 (944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03C0 (960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03D0 (976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0410 (1040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0420 (1056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0430 (1072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x00A0, 0x0901, 0x0981, 0x11E2, 0x1242, 0x1AA3, 0x1B03,   // 0x0440 (1088) pixels
-0x1B83, 0x23E4, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x0450 (1104) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2C25,   // 0x0460 (1120) pixels
-0x4488, 0x5D0B, 0x756E, 0x8DF1, 0xA674, 0xBED7, 0xD73A, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79E, 0xFFFF, 0xA654,   // 0x0470 (1136) pixels
-0x2404, 0x2404, 0x2404, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0480 (1152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0490 (1168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04A0 (1184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04B0 (1200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04C0 (1216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04D0 (1232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04E0 (1248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04F0 (1264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0500 (1280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1242, 0x1AC3, 0x1B23, 0x2384, 0x23E4, 0x2404,   // 0x0510 (1296) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x0520 (1312) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x3446, 0x4CC9, 0x652C,   // 0x0530 (1328) pixels
-0x7DAF, 0x9612, 0xAE95, 0xC6F8, 0xDF7B, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0540 (1344) pixels
-0xFFFF, 0xFFFF, 0xEF7D, 0x39E7, 0xD6BA, 0xFFFF, 0xA654, 0x2404, 0x2404, 0x2404, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0550 (1360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0560 (1376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0570 (1392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0580 (1408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0590 (1424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05A0 (1440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05B0 (1456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05C0 (1472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05D0 (1488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05E0 (1504) pixels
-0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x05F0 (1520) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x3446, 0x4CA9, 0x5D0B, 0x7D8F, 0x9612,   // 0x0600 (1536) pixels
-0xA674, 0xC6F8, 0xDF5B, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0610 (1552) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x2965, 0x0000, 0xDEDB, 0xFFFF, 0x9E53, 0x2404, 0x2404,   // 0x0620 (1568) pixels
-0x2404, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0630 (1584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0640 (1600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0650 (1616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0660 (1632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0670 (1648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0680 (1664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0690 (1680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06A0 (1696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06B0 (1712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x06C0 (1728) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x3446, 0x4CA9, 0x5D0B, 0x7D8F, 0x9612, 0xA674, 0xC6F8,   // 0x06D0 (1744) pixels
-0xDF5B, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06E0 (1760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x18E3,   // 0x06F0 (1776) pixels
-0x0000, 0x0000, 0xDEFB, 0xFFFF, 0x9E33, 0x2404, 0x2404, 0x2404, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0700 (1792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0710 (1808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0720 (1824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0730 (1840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0740 (1856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0750 (1872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0760 (1888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0770 (1904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0780 (1920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404,   // 0x0790 (1936) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x3446, 0x4CA9, 0x5D0B, 0x7D8F, 0x9612, 0xA674, 0xC6F8, 0xDF5B, 0xF7DE,   // 0x07A0 (1952) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07B0 (1968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07C0 (1984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x1082, 0x0000, 0x0000, 0x0000, 0xDEFB, 0xFFFF, 0x9E33, 0x2404, 0x2404, 0x2404, 0x0000,   // 0x07D0 (2000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07E0 (2016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07F0 (2032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0800 (2048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0810 (2064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0820 (2080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0830 (2096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0840 (2112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0850 (2128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0860 (2144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2B65, 0xCF19, 0xE79C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0870 (2160) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0880 (2176) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0890 (2192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x0841, 0x0000, 0x6B4D, 0x2965, 0x0000,   // 0x08A0 (2208) pixels
-0xE71C, 0xFFFF, 0x9E33, 0x2404, 0x2404, 0x2404, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08B0 (2224) pixels
-0x0000, 0x0000, 0x0841, 0x2124, 0x3186, 0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08C0 (2240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x3186, 0x2104, 0x0000, 0x0000, 0x0000,   // 0x08D0 (2256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18E3, 0x3186,   // 0x08E0 (2272) pixels
-0x2945, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08F0 (2288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18E3, 0x3186,   // 0x0900 (2304) pixels
-0x3186, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x3186, 0x2965, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,   // 0x0920 (2336) pixels
-0x3186, 0x3186, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352) pixels
-0x0000, 0x0000, 0x0841, 0x2104, 0x3186, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404,   // 0x0940 (2368) pixels
-0x2404, 0x2B25, 0xFFFF, 0xFFFF, 0xBDD7, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0950 (2384) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0960 (2400) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0970 (2416) pixels
-0x9CF3, 0x0020, 0x0000, 0x73AE, 0xFFFF, 0x2965, 0x0000, 0xE71C, 0xFFFF, 0x9E33, 0x2404, 0x2404, 0x2404, 0x0000, 0x0000, 0x0000,   // 0x0980 (2432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630C, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xBDD7, 0x5ACB,   // 0x0990 (2448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE59, 0xEF7D, 0xE71C, 0x3186, 0x0000, 0x2945, 0xA514,   // 0x09A0 (2464) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9CD3, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09B0 (2480) pixels
-0x0000, 0x0000, 0x4208, 0xAD55, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x630C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09C0 (2496) pixels
-0x0000, 0x0000, 0x0000, 0x5AEB, 0xEF5D, 0xEF7D, 0x9CD3, 0x0000, 0x0000, 0x3186, 0x9CF3, 0xCE59, 0xDEFB, 0x73AE, 0x0000, 0x0000,   // 0x09D0 (2512) pixels
-0x0000, 0x4A69, 0xA534, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xB596, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09E0 (2528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xC618, 0xEF7D, 0xE71C, 0x31A6, 0x0000, 0x2104, 0x9CF3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,   // 0x09F0 (2544) pixels
-0x4228, 0x0000, 0x0000, 0x0000, 0x2945, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x5ACB, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A00 (2560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xB5B6, 0x39E7,   // 0x0A10 (2576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2B25, 0xFFFF, 0xFFFF, 0x6B6D, 0x1082, 0x9492, 0xFFDF, 0xFFFF,   // 0x0A20 (2592) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A30 (2608) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A40 (2624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51, 0x0000, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0x2965, 0x0000, 0xE73C, 0xFFFF,   // 0x0A50 (2640) pixels
-0x9612, 0x2404, 0x2404, 0x23E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0xCE59, 0xFFFF, 0xFFFF,   // 0x0A60 (2656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-0xEF7D, 0xFFFF, 0xFFFF, 0x5AEB, 0x4A69, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x4228, 0x0000,   // 0x0A80 (2688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A90 (2704) pixels
-0xFFFF, 0xFFFF, 0xC618, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xDEDB, 0x0000, 0x7BEF,   // 0x0AA0 (2720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0000, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AB0 (2736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0x632C, 0x39C7,   // 0x0AC0 (2752) pixels
-0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4A69, 0x0000, 0x4A49, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AD0 (2768) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xCE59, 0xFFFF, 0xFFFF,   // 0x0AE0 (2784) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2B25,   // 0x0AF0 (2800) pixels
-0xFFFF, 0xFFFF, 0x6B6D, 0x0000, 0x0000, 0x2945, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B00 (2816) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B10 (2832) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0020, 0xAD55,   // 0x0B20 (2848) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x0000, 0xE73C, 0xFFFF, 0x9612, 0x2404, 0x2404, 0x23E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B30 (2864) pixels
-0x0000, 0x0000, 0x18E3, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0xCE79, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB,   // 0x0B40 (2880) pixels
-0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xAD55, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B50 (2896) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xBDD7, 0xFFFF,   // 0x0B60 (2912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0xBDD7, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B70 (2928) pixels
-0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xF79E, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x632C,   // 0x0B80 (2944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xDEDB, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B90 (2960) pixels
-0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0x8C71, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,   // 0x0BA0 (2976) pixels
-0x31A6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BB0 (2992) pixels
-0x0000, 0x0000, 0x18E3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xCE59, 0xBDF7, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,   // 0x0BC0 (3008) pixels
-0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2B25, 0xFFFF, 0xFFFF, 0x6B6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69, 0xE71C,   // 0x0BD0 (3024) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BE0 (3040) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BF0 (3056) pixels
-0xFFFF, 0xFFDF, 0x52AA, 0x0000, 0x1082, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x0000, 0xEF5D, 0xFFFF, 0x9612, 0x2404,   // 0x0C00 (3072) pixels
-0x2404, 0x23E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x2945, 0x0000,   // 0x0C10 (3088) pixels
-0x0000, 0x0000, 0x3186, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF,   // 0x0C20 (3104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x738E, 0x18C3, 0x0000, 0x10A2, 0x630C, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x0000, 0x0000,   // 0x0C30 (3120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x2124, 0x0000, 0x0000, 0x0000, 0x2124, 0xC618, 0xFFFF,   // 0x0C40 (3136) pixels
-0xFFFF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xBDF7,   // 0x0C50 (3152) pixels
-0x8430, 0x73AE, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0861, 0x738E, 0x31A6, 0x0020, 0x0000, 0x0000, 0x0000, 0x10A2, 0x8430, 0xFFFF,   // 0x0C60 (3168) pixels
-0xFFFF, 0xFFFF, 0xEF7D, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0x6B4D,   // 0x0C70 (3184) pixels
-0x1082, 0x0000, 0x4208, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xEF7D, 0x73AE, 0x2945, 0x18C3, 0x52AA, 0xE73C, 0xFFFF,   // 0x0C80 (3200) pixels
-0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x1082, 0x0000,   // 0x0C90 (3216) pixels
-0x0000, 0x0000, 0x4208, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF,   // 0x0CA0 (3232) pixels
-0x6B6D, 0x0000, 0x0841, 0x0861, 0x0000, 0x0000, 0x0841, 0x8430, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CB0 (3248) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CC0 (3264) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x39E7, 0x0000, 0x10A2, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CD0 (3280) pixels
-0xFFFF, 0x2124, 0x0000, 0xEF5D, 0xFFFF, 0x9612, 0x2404, 0x2404, 0x23C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69,   // 0x0CE0 (3296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7,   // 0x0CF0 (3312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D00 (3328) pixels
-0x2945, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0xFFDF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0841,   // 0x0D10 (3344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xDEDB, 0xFFFF, 0xFFFF, 0xEF5D, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E,   // 0x0D20 (3360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D30 (3376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D40 (3392) pixels
-0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,   // 0x0D50 (3408) pixels
-0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ACB,   // 0x0D60 (3424) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xFFDF, 0xFFFF, 0xFFFF, 0xB596, 0x0000,   // 0x0D70 (3440) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B6D, 0x0000, 0x2124, 0xE73C, 0x632C, 0x0000, 0x0000, 0x0000, 0x2104,   // 0x0D80 (3456) pixels
-0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D90 (3472) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x2965, 0x0000,   // 0x0DA0 (3488) pixels
-0x2945, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x0000, 0xEF7D, 0xFFFF, 0x8DF1, 0x2404, 0x2404, 0x23C4,   // 0x0DB0 (3504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DC0 (3520) pixels
-0x0000, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DD0 (3536) pixels
-0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51, 0x0000, 0x0000, 0x0000,   // 0x0DE0 (3552) pixels
-0x0000, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630C, 0xFFFF, 0xFFFF,   // 0x0DF0 (3568) pixels
-0xFFFF, 0x4A49, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E00 (3584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xFFFF, 0xFFFF,   // 0x0E10 (3600) pixels
-0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E20 (3616) pixels
-0x0000, 0x0020, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF,   // 0x0E30 (3632) pixels
-0xFFFF, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFDF, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E40 (3648) pixels
-0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0861, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B6D, 0x0000,   // 0x0E50 (3664) pixels
-0x2124, 0xFFFF, 0xFFFF, 0xCE79, 0x39C7, 0x0000, 0x0000, 0x0000, 0x4208, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E60 (3680) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E70 (3696) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x18E3, 0x0000, 0x31A6, 0xDEFB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2104,   // 0x0E80 (3712) pixels
-0x0000, 0xEF7D, 0xFFFF, 0x8DF1, 0x2404, 0x2404, 0x23C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x0E90 (3728) pixels
-0xE73C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xEF7D, 0xFFFF, 0xFFFF, 0xEF5D, 0x0000, 0x0000,   // 0x0EA0 (3744) pixels
-0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xF7BE, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186,   // 0x0EB0 (3760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0x0861, 0x0000, 0x0000, 0x0000,   // 0x0EC0 (3776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF,   // 0x0ED0 (3792) pixels
-0xFFFF, 0xB5B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EE0 (3808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF,   // 0x0EF0 (3824) pixels
-0xFFFF, 0xFFFF, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0x0000,   // 0x0F00 (3840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x0000, 0x0000, 0x0000, 0x0861, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F10 (3856) pixels
-0xCE59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x2404, 0x2404,   // 0x0F20 (3872) pixels
-0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B6D, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x18E3, 0x0000, 0x0000,   // 0x0F30 (3888) pixels
-0x0020, 0x6B6D, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F40 (3904) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x1082, 0x0000, 0x4228, 0xEF7D, 0xEF7D, 0xFFFF,   // 0x0F50 (3920) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2104, 0x0000, 0xF79E, 0xFFFF, 0x8DF1, 0x2404, 0x2404, 0x23C4, 0x0000, 0x0000,   // 0x0F60 (3936) pixels
-0x0000, 0x0000, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F70 (3952) pixels
-0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xCE79, 0x0000, 0x0000,   // 0x0F80 (3968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xFFDF, 0xFFFF, 0xFFFF, 0xE73C, 0x0000, 0x0000, 0x0000, 0x0020, 0xFFDF,   // 0x0F90 (3984) pixels
-0xFFFF, 0xFFFF, 0xD6BA, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0xF79E, 0xFFFF, 0xFFFF, 0xA514,   // 0x0FA0 (4000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FB0 (4016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x8410, 0xAD55, 0xBDD7, 0xBDD7, 0xAD55, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,   // 0x0FC0 (4032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xEF7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FD0 (4048) pixels
-0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186,   // 0x0FE0 (4064) pixels
-0x0000, 0x0000, 0x0000, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0FF0 (4080) pixels
-0x39E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2124, 0xFFFF,   // 0x1000 (4096) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x7BEF, 0x0020, 0x0000, 0x0000, 0x18C3, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1010 (4112) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75,   // 0x1020 (4128) pixels
-0x0841, 0x0000, 0x630C, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0000, 0xF79E,   // 0x1030 (4144) pixels
-0xFFFF, 0x8DF1, 0x2404, 0x2404, 0x23A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000,   // 0x1040 (4160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x0000, 0x0000, 0x0000,   // 0x1050 (4176) pixels
-0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEFB, 0xFFFF,   // 0x1060 (4192) pixels
-0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1070 (4208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A49,   // 0x1080 (4224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1090 (4240) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xD69A,   // 0x10A0 (4256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10B0 (4272) pixels
-0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10C0 (4288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x10D0 (4304) pixels
-0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xDEDB, 0x52AA, 0x0000,   // 0x10E0 (4320) pixels
-0x0000, 0x0000, 0x31A6, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10F0 (4336) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0000, 0x6B4D, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1100 (4352) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0000, 0xF7BE, 0xFFFF, 0x8DD1, 0x2404, 0x2404, 0x23A4, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1110 (4368) pixels
-0x0000, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C51,   // 0x1120 (4384) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1130 (4400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1140 (4416) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x0000, 0x0000,   // 0x1150 (4432) pixels
-0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1160 (4448) pixels
-0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000,   // 0x1170 (4464) pixels
-0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF,   // 0x1180 (4480) pixels
-0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000,   // 0x1190 (4496) pixels
-0x0000, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11A0 (4512) pixels
-0xFFFF, 0xFFFF, 0x738E, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11B0 (4528) pixels
-0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xBDF7, 0x2945, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11C0 (4544) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0000, 0xAD55,   // 0x11D0 (4560) pixels
-0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18C3, 0x0000, 0xF7BE, 0xFFFF, 0x85D0,   // 0x11E0 (4576) pixels
-0x2404, 0x2404, 0x23A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51, 0x0000, 0x0000, 0x0000,   // 0x11F0 (4592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D,   // 0x1200 (4608) pixels
-0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xEF7D,   // 0x1210 (4624) pixels
-0x0000, 0x0000, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55,   // 0x1220 (4640) pixels
-0xAD55, 0xAD55, 0xAD55, 0xAD55, 0x6B6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000,   // 0x1230 (4656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8C51, 0x4A49, 0x2965, 0x2104, 0x31A6,   // 0x1240 (4672) pixels
-0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000,   // 0x1250 (4688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1260 (4704) pixels
-0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0xAD55, 0xAD55, 0xAD55,   // 0x1270 (4720) pixels
-0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0x4208, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF,   // 0x1280 (4736) pixels
-0xFFFF, 0x6B4D, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8C71,   // 0x1290 (4752) pixels
-0x0861, 0x0000, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x12A0 (4768) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0000, 0xAD75, 0xFFFF, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x12B0 (4784) pixels
-0xFFFF, 0xFFFF, 0x18C3, 0x0000, 0xFFDF, 0xFFFF, 0x85D0, 0x2404, 0x2404, 0x2384, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228,   // 0x12C0 (4800) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFFF,   // 0x12D0 (4816) pixels
-0xFFFF, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12E0 (4832) pixels
-0x0000, 0x0000, 0x0841, 0xFFDF, 0xFFFF, 0xFFFF, 0xDEDB, 0x0000, 0x0000, 0x0000, 0x18C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x0000,   // 0x12F0 (4848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1300 (4864) pixels
-0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDB, 0xFFFF, 0xFFFF,   // 0x1310 (4880) pixels
-0xF79E, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1320 (4896) pixels
-0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x1330 (4912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x5ACB,   // 0x1340 (4928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1350 (4944) pixels
-0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,   // 0x1360 (4960) pixels
-0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x528A, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1370 (4976) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0000, 0xAD75, 0xFFFF, 0xEF7D,   // 0x1380 (4992) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x10A2, 0x0000, 0xFFDF, 0xFFFF, 0x85B0, 0x2404, 0x2404,   // 0x1390 (5008) pixels
-0x2384, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13A0 (5024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF,   // 0x13B0 (5040) pixels
-0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0000,   // 0x13C0 (5056) pixels
-0x0000, 0x0000, 0xF79E, 0xFFFF, 0xFFFF, 0xE73C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13D0 (5072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13E0 (5088) pixels
-0x0000, 0x0000, 0x0000, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xFFFF,   // 0x13F0 (5104) pixels
-0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1400 (5120) pixels
-0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF,   // 0x1410 (5136) pixels
-0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1420 (5152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D,   // 0x1430 (5168) pixels
-0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514,   // 0x1440 (5184) pixels
-0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1450 (5200) pixels
-0xFFFF, 0xFFFF, 0x39E7, 0x0000, 0xAD75, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1460 (5216) pixels
-0x10A2, 0x0000, 0xFFFF, 0xFFFF, 0x85B0, 0x2404, 0x2404, 0x1B83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF,   // 0x1470 (5232) pixels
-0xFFFF, 0xFFDF, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0000,   // 0x1480 (5248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1490 (5264) pixels
-0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x0000, 0x0000,   // 0x14A0 (5280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF,   // 0x14B0 (5296) pixels
-0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D, 0x0000,   // 0x14C0 (5312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C,   // 0x14D0 (5328) pixels
-0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000,   // 0x14E0 (5344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x0020, 0xF7BE, 0xFFFF,   // 0x14F0 (5360) pixels
-0xFFFF, 0xEF5D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404,   // 0x1500 (5376) pixels
-0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF,   // 0x1510 (5392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1520 (5408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x0000, 0xB596, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x1530 (5424) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x1082, 0x0000, 0xFFFF, 0xFFFF, 0x7DAF, 0x2404, 0x2404, 0x1B83, 0x0000,   // 0x1540 (5440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C51, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1550 (5456) pixels
-0x0000, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000,   // 0x1560 (5472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1570 (5488) pixels
-0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1580 (5504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1590 (5520) pixels
-0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15A0 (5536) pixels
-0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15B0 (5552) pixels
-0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15C0 (5568) pixels
-0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15D0 (5584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945,   // 0x15E0 (5600) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x18E3,   // 0x15F0 (5616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1600 (5632) pixels
-0x39E7, 0x0000, 0xB596, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xEF7D, 0xF7BE, 0xFFFF, 0x1082, 0x0000,   // 0x1610 (5648) pixels
-0xFFFF, 0xFFFF, 0x7DAF, 0x2404, 0x2404, 0x1B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x1620 (5664) pixels
-0xF7BE, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0x10A2, 0x0000, 0x0000, 0x0000,   // 0x1630 (5680) pixels
-0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49, 0xF79E, 0xFFFF, 0xFFFF,   // 0x1640 (5696) pixels
-0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x0841, 0x0000, 0x0000,   // 0x1650 (5712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1660 (5728) pixels
-0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xF7BE, 0xFFFF, 0xFFFF, 0xE73C, 0x10A2, 0x0000, 0x0000,   // 0x1670 (5744) pixels
-0x0000, 0x0000, 0x0000, 0x0841, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF,   // 0x1680 (5760) pixels
-0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1690 (5776) pixels
-0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16A0 (5792) pixels
-0xFFDF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404,   // 0x16B0 (5808) pixels
-0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16C0 (5824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16D0 (5840) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0xB5B6, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D,   // 0x16E0 (5856) pixels
-0xF7BE, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0x0861, 0x0020, 0xFFFF, 0xFFFF, 0x7D8F, 0x2404, 0x2404, 0x1B63, 0x0000, 0x0000, 0x0000,   // 0x16F0 (5872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8C71, 0x4228, 0x3186, 0x4A49, 0x94B2, 0xFFDF, 0xFFFF,   // 0x1700 (5888) pixels
-0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xEF7D, 0x9CD3, 0x6B4D, 0x5ACB,   // 0x1710 (5904) pixels
-0x5ACB, 0x73AE, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228,   // 0x1720 (5920) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x94B2, 0x630C, 0x4A69, 0x5ACB, 0x6B6D, 0x8C71, 0xD6BA, 0xFFFF, 0x10A2, 0x0000, 0x0000,   // 0x1730 (5936) pixels
-0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1740 (5952) pixels
-0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BEF, 0x4228, 0x31A6, 0x4208, 0x528A, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000,   // 0x1750 (5968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534,   // 0x1760 (5984) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000,   // 0x1770 (6000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x8430, 0x5ACB, 0x4A69, 0x5AEB, 0x738E, 0x9CF3,   // 0x1780 (6016) pixels
-0xE73C, 0xD6BA, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF,   // 0x1790 (6032) pixels
-0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x2104, 0xFFFF, 0xFFFF,   // 0x17A0 (6048) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000,   // 0x17B0 (6064) pixels
-0xB5B6, 0xFFFF, 0xF79E, 0xEF7D, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF, 0xFFFF, 0x0861, 0x0020, 0xFFFF, 0xFFFF,   // 0x17C0 (6080) pixels
-0x7D8F, 0x2404, 0x2404, 0x1B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x17D0 (6096) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17E0 (6112) pixels
-0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x0861, 0x0000,   // 0x17F0 (6128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1800 (6144) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000,   // 0x1810 (6160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1820 (6176) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000,   // 0x1830 (6192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1840 (6208) pixels
-0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1850 (6224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18C3, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326,   // 0x1860 (6240) pixels
-0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1870 (6256) pixels
-0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1880 (6272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1890 (6288) pixels
-0xEF7D, 0xFFFF, 0xFFFF, 0x0841, 0x0841, 0xFFFF, 0xFFFF, 0x758E, 0x2404, 0x2404, 0x1B43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18A0 (6304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x52AA, 0x0000,   // 0x18B0 (6320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x18C0 (6336) pixels
-0xFFFF, 0xFFFF, 0xE71C, 0x6B4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965,   // 0x18D0 (6352) pixels
-0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18E0 (6368) pixels
-0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3,   // 0x18F0 (6384) pixels
-0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x0000,   // 0x1900 (6400) pixels
-0x0000, 0x0000, 0xE73C, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF,   // 0x1910 (6416) pixels
-0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0000, 0x0000,   // 0x1920 (6432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x528A, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,   // 0x1930 (6448) pixels
-0x2965, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF,   // 0x1940 (6464) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1950 (6480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0xBDD7, 0xFFFF,   // 0x1960 (6496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xFFFF, 0xFFFF, 0x0841, 0x0841, 0xFFFF, 0xFFFF, 0x758E, 0x2404,   // 0x1970 (6512) pixels
-0x2404, 0x1B43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4A69, 0x9492, 0xB596,   // 0x1980 (6528) pixels
-0xBDF7, 0xAD75, 0x9492, 0x4A49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF,   // 0x1990 (6544) pixels
-0xFFFF, 0xD6BA, 0x8430, 0xAD75, 0xBDF7, 0xBDD7, 0xA534, 0x8410, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19A0 (6560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x6B4D, 0x9CF3, 0xB596, 0xBDF7, 0xB596, 0x9CF3, 0x8C51,   // 0x19B0 (6576) pixels
-0x5ACB, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x6B6D, 0x73AE, 0x6B4D, 0x1082, 0x0000, 0x0000, 0x0000,   // 0x19C0 (6592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x73AE, 0x9CF3, 0xB5B6, 0xC618, 0xBDD7, 0xAD75, 0x8C71,   // 0x19D0 (6608) pixels
-0x6B4D, 0x39C7, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0x73AE, 0x73AE, 0x4A49, 0x0000, 0x0000, 0x0000,   // 0x19E0 (6624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0x738E, 0x73AE, 0x630C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945,   // 0x19F0 (6640) pixels
-0x738E, 0x73AE, 0x6B4D, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0x7BCF, 0xA514,   // 0x1A00 (6656) pixels
-0xB5B6, 0xBDF7, 0xAD75, 0x9CD3, 0x8410, 0x4A69, 0x0861, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF,   // 0x1A10 (6672) pixels
-0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xF79E, 0xFFFF, 0xFFFF,   // 0x1A20 (6688) pixels
-0x9CD3, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A30 (6704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF,   // 0x1A40 (6720) pixels
-0xFFFF, 0x0020, 0x0861, 0xFFFF, 0xFFFF, 0x756E, 0x2404, 0x2404, 0x1B43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A50 (6736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A60 (6752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A70 (6768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A80 (6784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A90 (6800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AA0 (6816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AB0 (6832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AC0 (6848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AD0 (6864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AE0 (6880) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1AF0 (6896) pixels
-0xFFDF, 0xF79E, 0xF79E, 0xFFDF, 0xEF7D, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B00 (6912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B10 (6928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0020, 0x0861, 0xFFFF, 0xFFFF, 0x756E, 0x2404, 0x2404, 0x1B43,   // 0x1B20 (6944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B30 (6960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7,   // 0x1B40 (6976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B50 (6992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B60 (7008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B70 (7024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B80 (7040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B90 (7056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BA0 (7072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BB0 (7088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000,   // 0x1BC0 (7104) pixels
-0x2945, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79E, 0xF7BE, 0xF79E, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000,   // 0x1BD0 (7120) pixels
-0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1BE0 (7136) pixels
-0xFFFF, 0x3186, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000,   // 0x1BF0 (7152) pixels
-0x1082, 0xFFFF, 0xFFFF, 0x756E, 0x2404, 0x2404, 0x1B23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C00 (7168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C10 (7184) pixels
-0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C20 (7200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C30 (7216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C40 (7232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C50 (7248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C60 (7264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C70 (7280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C80 (7296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404,   // 0x1C90 (7312) pixels
-0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x1CA0 (7328) pixels
-0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1CB0 (7344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1CC0 (7360) pixels
-0xFFFF, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x1082, 0xFFFF, 0xFFFF, 0x6D4D, 0x2404, 0x2404, 0x1B23, 0x0000, 0x0000,   // 0x1CD0 (7376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CE0 (7392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000,   // 0x1CF0 (7408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D00 (7424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D10 (7440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D20 (7456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D30 (7472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D40 (7488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D50 (7504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D60 (7520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF,   // 0x1D70 (7536) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x2945, 0xFFFF,   // 0x1D80 (7552) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965,   // 0x1D90 (7568) pixels
-0x0000, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x10A2, 0xFFFF,   // 0x1DA0 (7584) pixels
-0xFFFF, 0x6D4D, 0x2404, 0x2404, 0x1B23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DB0 (7600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DC0 (7616) pixels
-0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DD0 (7632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DE0 (7648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DF0 (7664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E00 (7680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E10 (7696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E20 (7712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x1E40 (7744) pixels
-0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,   // 0x1E50 (7760) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E60 (7776) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x0000, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,   // 0x1E70 (7792) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x10A2, 0xFFFF, 0xFFFF, 0x6D4D, 0x2404, 0x2404, 0x1B03, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E80 (7808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E90 (7824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EA0 (7840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EB0 (7856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EC0 (7872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1ED0 (7888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EE0 (7904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EF0 (7920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F00 (7936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F10 (7952) pixels
-0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F20 (7968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F30 (7984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x0000, 0xC618,   // 0x1F40 (8000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000, 0x18C3, 0xFFFF, 0xFFFF, 0x6D4D,   // 0x1F50 (8016) pixels
-0x2404, 0x2404, 0x1B03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F60 (8032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D,   // 0x1F70 (8048) pixels
-0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F80 (8064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F90 (8080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FA0 (8096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FB0 (8112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FC0 (8128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FD0 (8144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FE0 (8160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF,   // 0x1FF0 (8176) pixels
-0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x2000 (8192) pixels
-0xFFFF, 0x94B2, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2010 (8208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x0000, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x2020 (8224) pixels
-0xFFFF, 0xF7BE, 0x0000, 0x18C3, 0xFFFF, 0xFFFF, 0x654C, 0x2404, 0x2404, 0x1B03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2030 (8240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2040 (8256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2050 (8272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2060 (8288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2070 (8304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2080 (8320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2090 (8336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20A0 (8352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20B0 (8368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20C0 (8384) pixels
-0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20D0 (8400) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20E0 (8416) pixels
-0xFFFF, 0xFFFF, 0x7D1E, 0xC6DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x0000, 0xC638, 0xFFFF, 0xFFFF,   // 0x20F0 (8432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0x652C, 0x2404, 0x2404,   // 0x2100 (8448) pixels
-0x1B03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2110 (8464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x4208, 0x39E7,   // 0x2120 (8480) pixels
-0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2130 (8496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2140 (8512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2150 (8528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2160 (8544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2170 (8560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2180 (8576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2190 (8592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C,   // 0x21A0 (8608) pixels
-0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492,   // 0x21B0 (8624) pixels
-0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9F, 0x1B1D, 0x857E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21C0 (8640) pixels
-0xFFFF, 0xFFFF, 0x2124, 0x0000, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,   // 0x21D0 (8656) pixels
-0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0x652C, 0x2404, 0x2404, 0x1AE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21E0 (8672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21F0 (8688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2200 (8704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2210 (8720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2220 (8736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2230 (8752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2240 (8768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2250 (8784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2260 (8800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404,   // 0x2270 (8816) pixels
-0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2280 (8832) pixels
-0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2290 (8848) pixels
-0xFFFF, 0x7D3E, 0x131D, 0x441E, 0xD71F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x0000, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x22A0 (8864) pixels
-0xFFFF, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x0000, 0x2104, 0xFFFF, 0xFFFF, 0x652C, 0x2404, 0x2404, 0x1AE3, 0x0000,   // 0x22B0 (8880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22C0 (8896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22D0 (8912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22E0 (8928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22F0 (8944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2300 (8960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2310 (8976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2320 (8992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2330 (9008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2340 (9024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965,   // 0x2350 (9040) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x2965,   // 0x2360 (9056) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C9E, 0x131D, 0x1B1D, 0x751E, 0xEF9F, 0xFFFF, 0xFFFF,   // 0x2370 (9072) pixels
-0x2124, 0x0000, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x0000, 0x2104,   // 0x2380 (9088) pixels
-0xFFFF, 0xFFFF, 0x5D0B, 0x2404, 0x2404, 0x1AE3, 0x0000, 0x0000, 0x0000, 0x0022, 0x00C7, 0x092B, 0x096E, 0x09B0, 0x09D1, 0x09D1,   // 0x2390 (9104) pixels
-0x09AF, 0x096D, 0x090A, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23A0 (9120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23B0 (9136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23C0 (9152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23D0 (9168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23E0 (9184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x23F0 (9200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2400 (9216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2410 (9232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404,   // 0x2420 (9248) pixels
-0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF,   // 0x2430 (9264) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2440 (9280) pixels
-0xFFDF, 0x5C7E, 0x131D, 0x131D, 0x235D, 0x9DDE, 0xFFDF, 0x2104, 0x0000, 0x0841, 0x7BEF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,   // 0x2450 (9296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x0000, 0x2124, 0xFFFF, 0xFFFF, 0x5D0B, 0x2404, 0x2404, 0x1AE7, 0x094C, 0x1214, 0x12BA,   // 0x2460 (9312) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12B9, 0x09D2, 0x00E9, 0x0000, 0x0000,   // 0x2470 (9328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2480 (9344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2490 (9360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24A0 (9376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24B0 (9392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24C0 (9408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24D0 (9424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24E0 (9440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24F0 (9456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF,   // 0x2500 (9472) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x3186, 0xFFFF, 0xFFFF,   // 0x2510 (9488) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x855E, 0x1B1D, 0x131D, 0x131D, 0x235D, 0x4398, 0x08E7,   // 0x2520 (9504) pixels
-0x0000, 0x0000, 0x2104, 0xAD55, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x0000, 0x2124, 0xFFFF, 0xF7BF,   // 0x2530 (9520) pixels
-0x4451, 0x1B74, 0x1B3A, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2540 (9536) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12DB, 0x098F, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2550 (9552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2560 (9568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2570 (9584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2580 (9600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2590 (9616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25A0 (9632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25B0 (9648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25C0 (9664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326,   // 0x25D0 (9680) pixels
-0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25E0 (9696) pixels
-0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x25F0 (9712) pixels
-0xFFFF, 0xCEDF, 0x3BDD, 0x131D, 0x131D, 0x131D, 0x131D, 0x231B, 0x09D1, 0x090A, 0x0043, 0x31A6, 0xC618, 0xEF7D, 0xFFFF, 0xFFFF,   // 0x2600 (9728) pixels
-0xFFFF, 0xFFFF, 0xE73D, 0x00A6, 0x2210, 0x545E, 0x1B1D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2610 (9744) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12DB, 0x094C,   // 0x2620 (9760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2630 (9776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2640 (9792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2650 (9808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2660 (9824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2670 (9840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2680 (9856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2690 (9872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26A0 (9888) pixels
-0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26B0 (9904) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x26C0 (9920) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA61F, 0x339D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x26D0 (9936) pixels
-0x131D, 0x131D, 0x12DC, 0x1277, 0x2AD7, 0x5C7C, 0x7D3E, 0x74FE, 0x4C3E, 0x233D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x26E0 (9952) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12FC, 0x12DB, 0x12BA, 0x1299, 0x12B9, 0x12FC, 0x131D, 0x131D,   // 0x26F0 (9968) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1299, 0x00C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2700 (9984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2710 (10000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2720 (10016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2730 (10032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2740 (10048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2750 (10064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2760 (10080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2770 (10096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF,   // 0x2780 (10112) pixels
-0x632C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,   // 0x2790 (10128) pixels
-0x18C3, 0x0000, 0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27A0 (10144) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xA61F, 0x43FE, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x27B0 (10160) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12FB, 0x1235, 0x098F, 0x092B, 0x00C8, 0x0084, 0x0021, 0x0000,   // 0x27C0 (10176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x00E8, 0x098F, 0x1256, 0x12FC, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x27D0 (10192) pixels
-0x09D2, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27E0 (10208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27F0 (10224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2800 (10240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2810 (10256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2820 (10272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2830 (10288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2840 (10304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2850 (10320) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2860 (10336) pixels
-0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x1082, 0x0000, 0x39E7, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71F,   // 0x2870 (10352) pixels
-0xE75F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FF, 0x8D7E, 0x43FE, 0x131D,   // 0x2880 (10368) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1B3D, 0x4C3E, 0x33D5, 0x23AC, 0x23E7, 0x1AA3,   // 0x2890 (10384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28A0 (10400) pixels
-0x0022, 0x094C, 0x1299, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1299, 0x0085, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28B0 (10416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28C0 (10432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28D0 (10448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28E0 (10464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28F0 (10480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2900 (10496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2910 (10512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2920 (10528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x632C, 0x0000,   // 0x2930 (10544) pixels
-0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xB5B6, 0x0841, 0x0000, 0x4A49, 0xF7BE,   // 0x2940 (10560) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6CDE, 0x441E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2950 (10576) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xCEDF, 0xA5FE, 0x855D, 0x4356, 0x11F1, 0x09B0, 0x098E, 0x19EF, 0x00E9,   // 0x2960 (10592) pixels
-0x29CA, 0xFFFF, 0xFFFF, 0x54EA, 0x2404, 0x2404, 0x12A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2970 (10608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x096D, 0x12DB, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2980 (10624) pixels
-0x12DC, 0x00A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2990 (10640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29A0 (10656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29B0 (10672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29C0 (10688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29D0 (10704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29E0 (10720) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29F0 (10736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404,   // 0x2A00 (10752) pixels
-0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE,   // 0x2A10 (10768) pixels
-0xFFFF, 0xA534, 0x0020, 0x0000, 0x5ACB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7D3E, 0x131D, 0x9DFE,   // 0x2A20 (10784) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2A30 (10800) pixels
-0xFFFF, 0xFFFF, 0xE71C, 0x632C, 0x0000, 0x0000, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0x54CA, 0x2404, 0x2404, 0x1282, 0x0000, 0x0000,   // 0x2A40 (10816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A50 (10832) pixels
-0x0000, 0x0000, 0x0042, 0x1235, 0x131D, 0x131D, 0x131D, 0x131D, 0x12DB, 0x0085, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A60 (10848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A70 (10864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A80 (10880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A90 (10896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AA0 (10912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AB0 (10928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AC0 (10944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AD0 (10960) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF,   // 0x2AE0 (10976) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF, 0x94B2, 0x0000, 0x0000, 0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2AF0 (10992) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAE5F, 0x131D, 0x235D, 0xEF7F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2B00 (11008) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x4208, 0x0000, 0x31A6, 0xFFFF,   // 0x2B10 (11024) pixels
-0xFFFF, 0x4CC9, 0x2404, 0x2404, 0x1282, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B20 (11040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x098E, 0x12FD, 0x131D, 0x131D, 0x131D,   // 0x2B30 (11056) pixels
-0x12B9, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B40 (11072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B50 (11088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B60 (11104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B70 (11120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B80 (11136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B90 (11152) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BA0 (11168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x2BB0 (11184) pixels
-0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8430, 0x0000, 0x0000,   // 0x2BC0 (11200) pixels
-0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0x1B3D, 0x131D, 0x5C9E, 0xFFFF,   // 0x2BD0 (11216) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2BE0 (11232) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x5AEB, 0xFFFF, 0xFFFF, 0x4CC9, 0x2404, 0x2404, 0x1282, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BF0 (11248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C00 (11264) pixels
-0x0000, 0x0000, 0x0000, 0x092B, 0x12FD, 0x131D, 0x131D, 0x131D, 0x1214, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C10 (11280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C20 (11296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C30 (11312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C40 (11328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C50 (11344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C60 (11360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C70 (11376) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C80 (11392) pixels
-0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2C90 (11408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x0000, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2CA0 (11424) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x64BE, 0x131D, 0x131D, 0x9DDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2CB0 (11440) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CC9,   // 0x2CC0 (11456) pixels
-0x2404, 0x2404, 0x1262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CD0 (11472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092B, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2CE0 (11488) pixels
-0x090A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CF0 (11504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D00 (11520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D10 (11536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D20 (11552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D30 (11568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D40 (11584) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D50 (11600) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF,   // 0x2D60 (11616) pixels
-0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x52AA, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2D70 (11632) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6DF, 0x131D, 0x131D, 0x1B3D, 0xC6BF, 0xFFFF,   // 0x2D80 (11648) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2D90 (11664) pixels
-0xFFFF, 0xFFFF, 0xEF9D, 0xBEB7, 0x754E, 0x3C27, 0x2404, 0x2404, 0x2404, 0x1262, 0x0000, 0x0000, 0x0000, 0x00A6, 0x094C, 0x098F,   // 0x2DA0 (11680) pixels
-0x098F, 0x092B, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DB0 (11696) pixels
-0x0000, 0x0000, 0x0000, 0x098F, 0x131D, 0x131D, 0x131D, 0x12DB, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DC0 (11712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x00E9,   // 0x2DD0 (11728) pixels
-0x098E, 0x09F2, 0x0A13, 0x0A13, 0x09D1, 0x094C, 0x00A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DE0 (11744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DF0 (11760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E00 (11776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E10 (11792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E20 (11808) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E30 (11824) pixels
-0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x4A49,   // 0x2E40 (11840) pixels
-0x0000, 0x0020, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2E50 (11856) pixels
-0xFFFF, 0xFFFF, 0x4C3E, 0x131D, 0x131D, 0x235D, 0xD71F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2E60 (11872) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77C, 0xAE55, 0x64CC, 0x3406, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x2E70 (11888) pixels
-0x1262, 0x0042, 0x098F, 0x12BA, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12FD, 0x09F3, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E80 (11904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1214, 0x131D, 0x131D, 0x131D, 0x09D1,   // 0x2E90 (11920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EA0 (11936) pixels
-0x0000, 0x0000, 0x0000, 0x00C7, 0x1277, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12B9, 0x092B,   // 0x2EB0 (11952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EC0 (11968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2ED0 (11984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EE0 (12000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EF0 (12016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F00 (12032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C,   // 0x2F10 (12048) pixels
-0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xEF7D, 0x39C7, 0x0000, 0x0861, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2F20 (12064) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71F, 0x1B1D, 0x131D, 0x131D, 0x235D, 0xCEDF, 0xFFFF,   // 0x2F30 (12080) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCF19, 0x8DD1, 0x4C89, 0x2C05, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x2F40 (12096) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x12AE, 0x12FC, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2F50 (12112) pixels
-0x131D, 0x131D, 0x12FC, 0x098E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F60 (12128) pixels
-0x0000, 0x0000, 0x0042, 0x12DB, 0x131D, 0x131D, 0x12FC, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F70 (12144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x094C, 0x12FD, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x2F80 (12160) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1235, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F90 (12176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FA0 (12192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FB0 (12208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FC0 (12224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FD0 (12240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404,   // 0x2FE0 (12256) pixels
-0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x31A6, 0xFFFF, 0xE73C, 0x2965, 0x0000, 0x1082, 0xCE59, 0xFFFF,   // 0x2FF0 (12272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x3000 (12288) pixels
-0xFFFF, 0x8D9E, 0x131D, 0x131D, 0x131D, 0x233D, 0xA5FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xC6F8, 0x85B0, 0x4468, 0x2404, 0x2404,   // 0x3010 (12304) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23C4, 0x1AE3, 0x1228, 0x12B8, 0x131D, 0x131D,   // 0x3020 (12320) pixels
-0x131D, 0x131D, 0x131D, 0x12FC, 0x1235, 0x0A13, 0x1256, 0x12FC, 0x131D, 0x131D, 0x131D, 0x1214, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3030 (12336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092B, 0x131D, 0x131D, 0x131D, 0x0A13, 0x0000,   // 0x3040 (12352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064,   // 0x3050 (12368) pixels
-0x12FD, 0x12B9, 0x1235, 0x0A13, 0x09D1, 0x09B0, 0x098F, 0x09B0, 0x09D2, 0x1277, 0x12FD, 0x131D, 0x131D, 0x131D, 0x131D, 0x1298,   // 0x3060 (12384) pixels
-0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3070 (12400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3080 (12416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3090 (12432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30A0 (12448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30B0 (12464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x31A6,   // 0x30C0 (12480) pixels
-0xDEFB, 0x2104, 0x0000, 0x18E3, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x30D0 (12496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64BE, 0x131D, 0x131D, 0x131D, 0x131D, 0x3BFB, 0x64D0,   // 0x30E0 (12512) pixels
-0x3C27, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23A4, 0x1AC3, 0x11E2,   // 0x30F0 (12528) pixels
-0x00C0, 0x0021, 0x09B0, 0x12FD, 0x131D, 0x131D, 0x131D, 0x131D, 0x1277, 0x090A, 0x0021, 0x0000, 0x0000, 0x0000, 0x0042, 0x09B0,   // 0x3100 (12544) pixels
-0x12FD, 0x131D, 0x131D, 0x09D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3110 (12560) pixels
-0x0000, 0x0000, 0x1256, 0x131D, 0x131D, 0x131D, 0x00A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3120 (12576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3130 (12592) pixels
-0x0000, 0x0043, 0x09F3, 0x131D, 0x131D, 0x131D, 0x131D, 0x0A13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3140 (12608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3150 (12624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3160 (12640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3170 (12656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3180 (12672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404,   // 0x3190 (12688) pixels
-0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x18C3, 0x10A2, 0x0000, 0x2945, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x31A0 (12704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x31B0 (12720) pixels
-0xDF5C, 0x43FB, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1B55, 0x23CA, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x31C0 (12736) pixels
-0x23A4, 0x1AA3, 0x11C2, 0x00C0, 0x0000, 0x0000, 0x0000, 0x094C, 0x12BA, 0x131D, 0x131D, 0x131D, 0x131D, 0x1299, 0x00E9, 0x0000,   // 0x31D0 (12752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E8, 0x12FC, 0x131D, 0x131D, 0x00E9, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31E0 (12768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A7, 0x131D, 0x131D, 0x131D, 0x1256, 0x0000, 0x0000,   // 0x31F0 (12784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3200 (12800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x096D, 0x131D, 0x131D, 0x131D, 0x131D, 0x0909,   // 0x3210 (12816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3220 (12832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3230 (12848) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3240 (12864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3250 (12880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3260 (12896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x0000, 0x3186,   // 0x3270 (12912) pixels
-0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x3280 (12928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xD73A, 0x95F2, 0x548A, 0x2C05, 0x2404, 0x2405, 0x1B74, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x3290 (12944) pixels
-0x1B3A, 0x1B72, 0x23CB, 0x1B85, 0x1AA3, 0x09A1, 0x00A0, 0x0000, 0x0000, 0x0000, 0x0021, 0x00E9, 0x09D1, 0x12DB, 0x131D, 0x131D,   // 0x32A0 (12960) pixels
-0x131D, 0x131D, 0x131D, 0x09D1, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C8,   // 0x32B0 (12976) pixels
-0x12FC, 0x131D, 0x1299, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32C0 (12992) pixels
-0x0000, 0x1214, 0x131D, 0x131D, 0x131D, 0x0909, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32D0 (13008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32E0 (13024) pixels
-0x0000, 0x0000, 0x098F, 0x131D, 0x131D, 0x131D, 0x1278, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x32F0 (13040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3300 (13056) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3310 (13072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3320 (13088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3330 (13104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326,   // 0x3340 (13120) pixels
-0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x4208, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x3350 (13136) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xC6F8, 0x8570, 0x4448, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3360 (13152) pixels
-0x2404, 0x1B90, 0x131C, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1299, 0x1235, 0x1214, 0x09F3, 0x1256,   // 0x3370 (13168) pixels
-0x12B9, 0x12FD, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12DB, 0x00E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3380 (13184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092B, 0x131D, 0x131D, 0x0909, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3390 (13200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0085, 0x12FD, 0x131D, 0x131D, 0x1299, 0x0001, 0x0000, 0x0000,   // 0x33A0 (13216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33B0 (13232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1277, 0x131D, 0x131D, 0x131D, 0x00A6, 0x0000,   // 0x33C0 (13248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33D0 (13264) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33E0 (13280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x33F0 (13296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3400 (13312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3410 (13328) pixels
-0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x528A, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x3420 (13344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0xB696, 0x752E, 0x3C27, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3430 (13360) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x1B68, 0x12F8, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x3440 (13376) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1256, 0x0063,   // 0x3450 (13392) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09D1,   // 0x3460 (13408) pixels
-0x131D, 0x1214, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3470 (13424) pixels
-0x09F2, 0x131D, 0x131D, 0x131D, 0x09B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3480 (13440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3490 (13456) pixels
-0x0000, 0x092B, 0x131D, 0x131D, 0x131D, 0x098F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34A0 (13472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34B0 (13488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34C0 (13504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34D0 (13520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x34E0 (13536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF,   // 0x34F0 (13552) pixels
-0x630C, 0x5AEB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77C, 0xA634, 0x5CCB, 0x3406, 0x2404,   // 0x3500 (13568) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23E4, 0x1B63, 0x1262, 0x0941, 0x0040,   // 0x3510 (13584) pixels
-0x0000, 0x0000, 0x0909, 0x1278, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x3520 (13600) pixels
-0x131D, 0x131D, 0x131D, 0x12BA, 0x090A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3530 (13616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1235, 0x12BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3540 (13632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x12FC, 0x131D, 0x131D, 0x12FD, 0x00A6, 0x0000, 0x0000, 0x0000,   // 0x3550 (13648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3560 (13664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x12FD, 0x131D, 0x131D, 0x1214, 0x0000, 0x0000, 0x0000,   // 0x3570 (13680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3580 (13696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3590 (13712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35A0 (13728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35B0 (13744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x35C0 (13760) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD73A, 0x95D2,   // 0x35D0 (13776) pixels
-0x548A, 0x2C05, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23E4, 0x1B23,   // 0x35E0 (13792) pixels
-0x1242, 0x0941, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C7, 0x09D1, 0x12BA, 0x131D, 0x131D,   // 0x35F0 (13808) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1298, 0x094D, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3600 (13824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x098E,   // 0x3610 (13840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x098E,   // 0x3620 (13856) pixels
-0x131D, 0x131D, 0x131D, 0x12B9, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3630 (13872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3640 (13888) pixels
-0x1299, 0x131D, 0x131D, 0x1277, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3650 (13904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3660 (13920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3670 (13936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3680 (13952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3690 (13968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x3326, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x36A0 (13984) pixels
-0xF7DE, 0xC6F8, 0x8570, 0x4448, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x36B0 (14000) pixels
-0x2404, 0x23E4, 0x1B23, 0x1222, 0x0921, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36C0 (14016) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0084, 0x090A, 0x098F, 0x09F2, 0x1214, 0x0A13, 0x09D1, 0x096D, 0x00E8, 0x0063, 0x0000,   // 0x36D0 (14032) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36E0 (14048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x36F0 (14064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x12B9, 0x131D, 0x131D, 0x131D, 0x1256, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3700 (14080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3710 (14096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1277, 0x131D, 0x131D, 0x1257, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3720 (14112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3730 (14128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3740 (14144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3750 (14160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3760 (14176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404,   // 0x3770 (14192) pixels
-0x2404, 0x2404, 0x3326, 0xEF9D, 0xB696, 0x6D0D, 0x3C27, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3780 (14208) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x23C4, 0x1B03, 0x1222, 0x0901, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3790 (14224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37A0 (14240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37B0 (14256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37C0 (14272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A7, 0x12FD,   // 0x37D0 (14288) pixels
-0x131D, 0x131D, 0x131D, 0x0A13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x37E0 (14304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12BA, 0x131D,   // 0x37F0 (14320) pixels
-0x131D, 0x0A13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3800 (14336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3810 (14352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3820 (14368) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3830 (14384) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3840 (14400) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x23E4, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3850 (14416) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23C4, 0x1AC3, 0x11C2, 0x08E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3860 (14432) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3870 (14448) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3880 (14464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3890 (14480) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38A0 (14496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x096E, 0x131D, 0x131D, 0x131D, 0x131D, 0x1235, 0x0042, 0x0000, 0x0000, 0x0000,   // 0x38B0 (14512) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38C0 (14528) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0085, 0x131D, 0x131D, 0x131D, 0x092B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38D0 (14544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38E0 (14560) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x38F0 (14576) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3900 (14592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3910 (14608) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3920 (14624) pixels
-0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23C4, 0x1AE3, 0x11E2, 0x08E1, 0x0000, 0x0000,   // 0x3930 (14640) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3940 (14656) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3950 (14672) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3960 (14688) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3970 (14704) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1214, 0x131D,   // 0x3980 (14720) pixels
-0x131D, 0x131D, 0x131D, 0x12BA, 0x00E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3990 (14736) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1214, 0x131D, 0x131D, 0x12FD, 0x0042,   // 0x39A0 (14752) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39B0 (14768) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39C0 (14784) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39D0 (14800) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39E0 (14816) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x39F0 (14832) pixels
-0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x23A4, 0x1AC3, 0x11E2,   // 0x3A00 (14848) pixels
-0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A10 (14864) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A20 (14880) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A30 (14896) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A40 (14912) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A50 (14928) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1214, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x1235, 0x0064, 0x0000, 0x0000,   // 0x3A60 (14944) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A70 (14960) pixels
-0x0000, 0x098F, 0x131D, 0x131D, 0x131D, 0x09F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A80 (14976) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3A90 (14992) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AA0 (15008) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AB0 (15024) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AC0 (15040) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404, 0x2404,   // 0x3AD0 (15056) pixels
-0x23A4, 0x1AA3, 0x09A1, 0x00A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AE0 (15072) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3AF0 (15088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B00 (15104) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B10 (15120) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B20 (15136) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x098F, 0x12FD,   // 0x3B30 (15152) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x12FD, 0x1214, 0x00E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B40 (15168) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x09F3, 0x131D, 0x131D, 0x131D, 0x12DC, 0x0043, 0x0000, 0x0000, 0x0000,   // 0x3B50 (15184) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B60 (15200) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B70 (15216) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B80 (15232) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3B90 (15248) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BA0 (15264) pixels
-0x0000, 0x2404, 0x2404, 0x1B83, 0x1282, 0x09A1, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BB0 (15280) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BC0 (15296) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BD0 (15312) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BE0 (15328) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BF0 (15344) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C00 (15360) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C7, 0x12BA, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12FC, 0x1214,   // 0x3C10 (15376) pixels
-0x096E, 0x00C8, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x00E9, 0x09D1, 0x12DC, 0x131D, 0x131D,   // 0x3C20 (15392) pixels
-0x131D, 0x12FD, 0x090A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C30 (15408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C40 (15424) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C50 (15440) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C60 (15456) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C70 (15472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0961, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C80 (15488) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3C90 (15504) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CA0 (15520) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CB0 (15536) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CC0 (15552) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3CD0 (15568) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x094D,   // 0x3CE0 (15584) pixels
-0x12BA, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12FC, 0x12BA, 0x1278, 0x1277, 0x1256, 0x1298,   // 0x3CF0 (15600) pixels
-0x12DC, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x094C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D00 (15616) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D10 (15632) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D20 (15648) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D30 (15664) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D40 (15680) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D50 (15696) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D60 (15712) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D70 (15728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D80 (15744) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3D90 (15760) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DA0 (15776) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DB0 (15792) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x094D, 0x12B9, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x3DC0 (15808) pixels
-0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x12DB, 0x00E8, 0x0000,   // 0x3DD0 (15824) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DE0 (15840) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3DF0 (15856) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E00 (15872) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E10 (15888) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E20 (15904) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E30 (15920) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E40 (15936) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E50 (15952) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E60 (15968) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E70 (15984) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E80 (16000) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3E90 (16016) pixels
-0x0000, 0x00A6, 0x09AF, 0x1298, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D, 0x131D,   // 0x3EA0 (16032) pixels
-0x131D, 0x131D, 0x1278, 0x096D, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EB0 (16048) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EC0 (16064) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3ED0 (16080) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EE0 (16096) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3EF0 (16112) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F00 (16128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F10 (16144) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F20 (16160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F30 (16176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F40 (16192) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F50 (16208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F60 (16224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x00E8, 0x098F, 0x09F3, 0x1256,   // 0x3F70 (16240) pixels
-0x12BA, 0x12DB, 0x12DB, 0x12DB, 0x12B9, 0x1235, 0x09D1, 0x094D, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F80 (16256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3F90 (16272) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FA0 (16288) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FB0 (16304) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FC0 (16320) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3FD0 (16336) pixels
-};
+// Generated by logo.py from logo.png; do not edit.
+// 215x76 pixels, 275 colours, 3370 runs: 7290 bytes instead of 32680 as raw RGB565.
+
+#include <operame_image.h>
+
+const uint16_t OPERAME_LOGO_PALETTE[275] PROGMEM = {
+    0x0000, 0xffff, 0x2404, 0x131d, 0xef7d, 0xffdf, 0xf7be, 0x3326, 0x3186, 0xf79e, 0x2945, 0xe73c, 0x0841, 0x1082, 0x2965, 0xad55,
+    0xbdd7, 0x0020, 0x73ae, 0x632c, 0x6b4d, 0x738e, 0xc618, 0x2124, 0x8c71, 0x18e3, 0x2104, 0x630c, 0x31a6, 0x39c7, 0x0861, 0x10a2,
+    0x9cf3, 0xef5d, 0x12fd, 0xa534, 0xd6ba, 0xe71c, 0x39e7, 0xbdf7, 0x4208, 0x4228, 0x9492, 0xce59, 0x0021, 0x098f, 0x09d1, 0x1214,
+    0x18c3, 0x8430, 0xad75, 0x12ba, 0x12db, 0x12fc, 0x6b6d, 0x9cd3, 0x4a49, 0x4a69, 0x5acb, 0x23a4, 0x5aeb, 0x8410, 0xa514, 0xb596,
+    0xb5b6, 0x092b, 0x1235, 0x12b9, 0x23e4, 0x94b2, 0x0040, 0x0042, 0x00e9, 0x0a13, 0x1256, 0x1299, 0x1b23, 0x52aa, 0x9612, 0xce79,
+    0xdedb, 0x00a6, 0x094c, 0x1262, 0x1277, 0x1ac3, 0x23c4, 0xc6f8, 0xdefb, 0x0022, 0x00c0, 0x090a, 0x09a1, 0x09b0, 0x1b03, 0x8c51,
+    0xc638, 0xf7de, 0x0043, 0x0064, 0x00e8, 0x098e, 0x09f3, 0x1aa3, 0x528a, 0x5d0b, 0x7d8f, 0x8df1, 0x0063, 0x0921, 0x096d, 0x11e2,
+    0x12dc, 0x1ae3, 0x1b1d, 0x1b43, 0x1b83, 0x235d, 0x3446, 0x652c, 0x0060, 0x0085, 0x00a0, 0x00c7, 0x00c8, 0x0909, 0x094d, 0x1202,
+    0x1242, 0x1278, 0x1282, 0x1298, 0x1b63, 0x2b25, 0x3c27, 0x4ca9, 0x4cc9, 0x6d4d, 0x756e, 0x7bef, 0x9e33, 0xa674, 0xd69a, 0xd71f,
+    0x0901, 0x096e, 0x09d2, 0x09f2, 0x1b3d, 0x2384, 0x2c05, 0x4c3e, 0x7bcf, 0x7d3e, 0x7daf, 0x85b0, 0xcedf, 0xd73a, 0xdf5b, 0xef9d,
+    0xf7bf, 0x0001, 0x0084, 0x00a7, 0x08e1, 0x0941, 0x0981, 0x09af, 0x11c2, 0x1222, 0x1b3a, 0x1b74, 0x233d, 0x3406, 0x43fe, 0x441e,
+    0x4448, 0x548a, 0x5c9e, 0x64be, 0x758e, 0x8570, 0x85d0, 0x8dd1, 0x9dde, 0xa5fe, 0xa61f, 0xa654, 0xb696, 0xc6df, 0xcf19, 0xe77c,
+    0x0080, 0x08e7, 0x0961, 0x11f1, 0x1228, 0x1257, 0x12a2, 0x12ae, 0x12b8, 0x12f8, 0x12fb, 0x131c, 0x19ef, 0x1ae7, 0x1b55, 0x1b68,
+    0x1b72, 0x1b85, 0x1b90, 0x2210, 0x231b, 0x23ac, 0x23ca, 0x23cb, 0x23e7, 0x2405, 0x29ca, 0x2ad7, 0x2b65, 0x2c25, 0x339d, 0x33d5,
+    0x3bdd, 0x3bfb, 0x4356, 0x4398, 0x43fb, 0x4451, 0x4468, 0x4488, 0x4c89, 0x545e, 0x54ca, 0x54ea, 0x5c7c, 0x5c7e, 0x5ccb, 0x64cc,
+    0x64d0, 0x654c, 0x6cde, 0x6d0d, 0x74fe, 0x751e, 0x752e, 0x754e, 0x7d1e, 0x855d, 0x855e, 0x857e, 0x8d7e, 0x8d9e, 0x95d2, 0x95f2,
+    0x9dfe, 0x9e53, 0xa634, 0xae55, 0xae5f, 0xae75, 0xae95, 0xbe9f, 0xbeb7, 0xbed7, 0xc6bf, 0xd6ff, 0xdf5c, 0xdf7b, 0xe73d, 0xe75f,
+    0xe79c, 0xef7f, 0xef9f,
+};
+
+const uint16_t OPERAME_LOGO_RUNS[3370] PROGMEM = {
+    0x0035, 0x0880, 0x3c00, 0x2d00, 0x3680, 0x2e00, 0x3f80, 0x2980, 0x2a80, 0x2600, 0x1d80, 0x2300, 0x007f, 0x0042, 0x3c00, 0x2d00,
+    0x3680, 0x2e00, 0x3f80, 0x2980, 0x2a80, 0x2600, 0x1d80, 0x0109, 0x2300, 0x007f, 0x0038, 0x2300, 0x2d00, 0x3680, 0x2e00, 0x3f80,
+    0x2980, 0x2a80, 0x2600, 0x1d80, 0x0113, 0x2300, 0x007f, 0x002e, 0x2300, 0x3d00, 0x4800, 0x5300, 0x3780, 0x4000, 0x3380, 0x2f00,
+    0x3a00, 0x2200, 0x011c, 0x2300, 0x007f, 0x0024, 0x3c00, 0x2d00, 0x3680, 0x2e00, 0x3f80, 0x2980, 0x2a80, 0x3980, 0x1d80, 0x011c,
+    0x3b00, 0x4380, 0x3b80, 0x3500, 0x2700, 0x8280, 0x2b80, 0x3580, 0x0102, 0x0880, 0x007f, 0x001a, 0x2300, 0x3d00, 0x4800, 0x5300,
+    0x3780, 0x4000, 0x3380, 0x2f00, 0x3a00, 0x2200, 0x011c, 0x6e80, 0x7380, 0x3480, 0x4500, 0x3580, 0x4680, 0x8480, 0x4e80, 0x0300,
+    0x0083, 0x0300, 0x0480, 0x0080, 0x5d80, 0x0102, 0x0880, 0x007f, 0x0015, 0x4000, 0x2a80, 0x2600, 0x4a80, 0x2200, 0x011d, 0x3b00,
+    0x4400, 0x3b80, 0x4d00, 0x2700, 0x8300, 0x2b80, 0x8680, 0x3080, 0x008b, 0x0200, 0x1300, 0x1200, 0x0080, 0x5d80, 0x0102, 0x0880,
+    0x007f, 0x0015, 0x0119, 0x3b00, 0x4380, 0x3480, 0x3500, 0x2700, 0x4680, 0x2b80, 0x4f00, 0x3080, 0x0093, 0x0580, 0x0700, 0x0000,
+    0x2800, 0x0080, 0x8080, 0x0102, 0x007f, 0x0016, 0x0110, 0x3b00, 0x4380, 0x3480, 0x3500, 0x2700, 0x4680, 0x2b80, 0x4f00, 0x3080,
+    0x009b, 0x1200, 0x0c80, 0x0001, 0x2c00, 0x0080, 0x4600, 0x0102, 0x007f, 0x0016, 0x0107, 0x3b00, 0x4380, 0x3480, 0x3500, 0x2700,
+    0x4680, 0x2b80, 0x4f00, 0x3080, 0x00a3, 0x0b00, 0x0680, 0x0002, 0x2c00, 0x0080, 0x4600, 0x0102, 0x007f, 0x0016, 0x0103, 0x6e00,
+    0x5f00, 0x8800, 0x00ac, 0x1f80, 0x0600, 0x0000, 0x0a00, 0x0700, 0x0000, 0x1280, 0x0080, 0x4600, 0x0102, 0x000b, 0x0600, 0x0b80,
+    0x0400, 0x0d00, 0x0600, 0x0011, 0x0880, 0x0d00, 0x0400, 0x0d00, 0x000f, 0x0880, 0x0c80, 0x0400, 0x0500, 0x0680, 0x001a, 0x0600,
+    0x0c80, 0x0401, 0x0d00, 0x0011, 0x0600, 0x0400, 0x0700, 0x0680, 0x0006, 0x0680, 0x0401, 0x0f80, 0x000e, 0x0600, 0x0d00, 0x0400,
+    0x0b80, 0x0600, 0x0005, 0x0103, 0x4280, 0x0081, 0x0800, 0x1080, 0x00a9, 0x1000, 0x0880, 0x0000, 0x0900, 0x0080, 0x0700, 0x0000,
+    0x1280, 0x0080, 0x4600, 0x0102, 0x0009, 0x0d80, 0x1380, 0x0083, 0x0280, 0x0800, 0x1d00, 0x0008, 0x1580, 0x0200, 0x1280, 0x0400,
+    0x0000, 0x0500, 0x1f00, 0x0280, 0x0082, 0x1080, 0x1b80, 0x0c80, 0x000a, 0x1400, 0x0780, 0x0300, 0x0083, 0x1580, 0x0d80, 0x0007,
+    0x1e00, 0x1080, 0x0200, 0x1b80, 0x0001, 0x0400, 0x1000, 0x1580, 0x2c00, 0x0900, 0x0002, 0x1c80, 0x1180, 0x1280, 0x0084, 0x0480,
+    0x1f80, 0x1400, 0x0007, 0x0b00, 0x0200, 0x1280, 0x0e00, 0x0000, 0x0d00, 0x1000, 0x0280, 0x0082, 0x1200, 0x1480, 0x0002, 0x0500,
+    0x1900, 0x0083, 0x4700, 0x1d00, 0x000a, 0x1e00, 0x1380, 0x0083, 0x0300, 0x2000, 0x1300, 0x0003, 0x0103, 0x4280, 0x0081, 0x1b00,
+    0x0680, 0x1500, 0x0280, 0x00a6, 0x2f80, 0x0001, 0x1b80, 0x0081, 0x0700, 0x0000, 0x0580, 0x0080, 0x2700, 0x0101, 0x2200, 0x0007,
+    0x0c80, 0x1580, 0x0088, 0x0b00, 0x0f80, 0x0006, 0x0200, 0x0081, 0x1e00, 0x1c80, 0x0480, 0x0086, 0x0480, 0x1480, 0x0007, 0x0600,
+    0x1f00, 0x0088, 0x0b00, 0x0680, 0x0005, 0x0a80, 0x0081, 0x2800, 0x0000, 0x4580, 0x0083, 0x1000, 0x0002, 0x1b80, 0x0089, 0x2280,
+    0x0006, 0x0580, 0x0081, 0x0980, 0x0e80, 0x0200, 0x0085, 0x0280, 0x1c80, 0x0000, 0x1c00, 0x0300, 0x0086, 0x1e80, 0x0007, 0x0d00,
+    0x1580, 0x0088, 0x1500, 0x0002, 0x0103, 0x4280, 0x0081, 0x1b00, 0x0001, 0x0500, 0x0800, 0x00a4, 0x0980, 0x0000, 0x0880, 0x0780,
+    0x0082, 0x0500, 0x0000, 0x0580, 0x0080, 0x2700, 0x0101, 0x2200, 0x0006, 0x0c80, 0x2c00, 0x0083, 0x1280, 0x2780, 0x0580, 0x0083,
+    0x2800, 0x0f80, 0x0005, 0x0200, 0x0081, 0x0780, 0x0300, 0x0088, 0x0300, 0x0500, 0x0005, 0x0880, 0x0800, 0x0083, 0x1200, 0x0800,
+    0x2780, 0x0083, 0x1580, 0x0880, 0x0004, 0x0a80, 0x0081, 0x0480, 0x0a80, 0x0084, 0x0c00, 0x0002, 0x0980, 0x0082, 0x0200, 0x2800,
+    0x1080, 0x0084, 0x0900, 0x0005, 0x0580, 0x0081, 0x0c00, 0x1080, 0x0087, 0x1080, 0x0e00, 0x0300, 0x0088, 0x0e80, 0x0005, 0x0c80,
+    0x1280, 0x0082, 0x0280, 0x1580, 0x1380, 0x2c00, 0x0083, 0x0c00, 0x0001, 0x0103, 0x4280, 0x0081, 0x1b00, 0x0003, 0x1c80, 0x1280,
+    0x00a0, 0x0280, 0x2680, 0x0000, 0x0680, 0x0b00, 0x0083, 0x0500, 0x0000, 0x1080, 0x0080, 0x2700, 0x0101, 0x2200, 0x0006, 0x1380,
+    0x0082, 0x0b00, 0x0500, 0x0002, 0x0400, 0x1580, 0x0082, 0x1900, 0x0005, 0x0200, 0x0083, 0x0200, 0x0a80, 0x1800, 0x0000, 0x0f80,
+    0x0d80, 0x1080, 0x0082, 0x3000, 0x0005, 0x1880, 0x0082, 0x0b00, 0x0b80, 0x0002, 0x0b80, 0x0b00, 0x0082, 0x4c00, 0x0004, 0x0a80,
+    0x0082, 0x0280, 0x0081, 0x1380, 0x1880, 0x0900, 0x1300, 0x0002, 0x0f00, 0x0a80, 0x0e00, 0x0880, 0x0002, 0x0f80, 0x1880, 0x0082,
+    0x0200, 0x0600, 0x0004, 0x0580, 0x0081, 0x0280, 0x0080, 0x0480, 0x0a00, 0x0680, 0x0000, 0x1400, 0x1280, 0x0082, 0x0300, 0x0080,
+    0x0200, 0x0900, 0x0500, 0x1800, 0x2680, 0x0580, 0x0082, 0x1180, 0x0005, 0x0b00, 0x0082, 0x1b80, 0x0680, 0x0002, 0x1400, 0x1280,
+    0x0082, 0x1300, 0x0000, 0x0103, 0x0380, 0x0081, 0x1b00, 0x0000, 0x0600, 0x0f00, 0x0001, 0x0600, 0x1880, 0x0300, 0x009d, 0x0200,
+    0x1300, 0x0000, 0x0f80, 0x2780, 0x0084, 0x0b80, 0x0000, 0x1080, 0x0080, 0x2700, 0x0101, 0x2b00, 0x0005, 0x1c80, 0x0082, 0x2780,
+    0x0600, 0x0004, 0x0f00, 0x1200, 0x0082, 0x1300, 0x0004, 0x0200, 0x0082, 0x0200, 0x0500, 0x0004, 0x0500, 0x0300, 0x0082, 0x0e00,
+    0x0003, 0x0c80, 0x0280, 0x0081, 0x1200, 0x0600, 0x0004, 0x0600, 0x2800, 0x0081, 0x1080, 0x0600, 0x0003, 0x0a80, 0x0083, 0x1280,
+    0x0e00, 0x000f, 0x1e80, 0x0082, 0x1480, 0x0004, 0x0580, 0x0082, 0x0280, 0x0e00, 0x0003, 0x1c80, 0x0083, 0x0300, 0x0700, 0x0003,
+    0x0e80, 0x0082, 0x1080, 0x0004, 0x1d00, 0x0082, 0x1f00, 0x0005, 0x0500, 0x0280, 0x0081, 0x1f80, 0x0000, 0x0103, 0x0380, 0x0081,
+    0x1b00, 0x0000, 0x0b80, 0x0580, 0x0980, 0x0002, 0x0d00, 0x0780, 0x009b, 0x0580, 0x0700, 0x0000, 0x0500, 0x1200, 0x0085, 0x0b80,
+    0x0000, 0x0200, 0x0080, 0x3580, 0x0101, 0x2b00, 0x0005, 0x2000, 0x0082, 0x1480, 0x0006, 0x1c80, 0x0082, 0x1f00, 0x0004, 0x0200,
+    0x0082, 0x0980, 0x0006, 0x0c00, 0x0082, 0x2f80, 0x0003, 0x1e80, 0x0082, 0x3400, 0x0006, 0x0d80, 0x0082, 0x1c00, 0x0003, 0x0a80,
+    0x0083, 0x0e00, 0x0010, 0x0500, 0x0082, 0x0900, 0x0004, 0x0580, 0x0082, 0x1500, 0x0004, 0x0880, 0x0200, 0x0082, 0x1880, 0x0005,
+    0x1200, 0x0082, 0x0f80, 0x0003, 0x1380, 0x0081, 0x0280, 0x1800, 0x0006, 0x1000, 0x0082, 0x0f00, 0x0103, 0x0380, 0x0081, 0x1b00,
+    0x0000, 0x0b80, 0x0081, 0x2780, 0x0e80, 0x0002, 0x1400, 0x1200, 0x0098, 0x1200, 0x0c80, 0x0000, 0x0e00, 0x2c00, 0x0280, 0x0085,
+    0x0d00, 0x0000, 0x0200, 0x0080, 0x3580, 0x0101, 0x2b00, 0x0004, 0x0880, 0x0300, 0x0081, 0x0580, 0x0007, 0x0880, 0x0200, 0x0081,
+    0x1080, 0x0004, 0x0200, 0x0081, 0x0300, 0x0600, 0x0006, 0x0400, 0x0082, 0x0b00, 0x0003, 0x1580, 0x0082, 0x0f00, 0x0006, 0x0f80,
+    0x0082, 0x1880, 0x0003, 0x0a80, 0x0082, 0x2000, 0x0011, 0x0f00, 0x0082, 0x1880, 0x0004, 0x0580, 0x0082, 0x0700, 0x0005, 0x3000,
+    0x0082, 0x0e00, 0x0005, 0x1000, 0x0082, 0x0500, 0x0002, 0x0f00, 0x0082, 0x1580, 0x0007, 0x2680, 0x0082, 0x1480, 0x0103, 0x0380,
+    0x0081, 0x1b00, 0x0000, 0x0b80, 0x0083, 0x0780, 0x0c80, 0x0001, 0x0880, 0x1b00, 0x0480, 0x0095, 0x3000, 0x0680, 0x0000, 0x1480,
+    0x0201, 0x0086, 0x0d00, 0x0000, 0x0480, 0x0080, 0x3580, 0x0101, 0x2b00, 0x0004, 0x0400, 0x0082, 0x1f80, 0x0008, 0x0800, 0x0082,
+    0x0d00, 0x0003, 0x0200, 0x0081, 0x2780, 0x0007, 0x0880, 0x0280, 0x0081, 0x0580, 0x0002, 0x0880, 0x0280, 0x0081, 0x1200, 0x0688,
+    0x0480, 0x0081, 0x1f00, 0x0003, 0x0a80, 0x0082, 0x0a80, 0x000b, 0x1400, 0x1e80, 0x0780, 0x0801, 0x0780, 0x1000, 0x0082, 0x0c00,
+    0x0004, 0x0580, 0x0081, 0x0200, 0x0006, 0x1f80, 0x0082, 0x0600, 0x0005, 0x1880, 0x0082, 0x0400, 0x0002, 0x1300, 0x0082, 0x1b80,
+    0x0687, 0x1300, 0x0082, 0x0980, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0b80, 0x0084, 0x0300, 0x4580, 0x0880, 0x0001, 0x1800,
+    0x1f00, 0x0093, 0x1900, 0x0600, 0x0000, 0x0d80, 0x0280, 0x0301, 0x0086, 0x0c80, 0x0000, 0x0480, 0x0080, 0x3580, 0x0101, 0x1d80,
+    0x0004, 0x1c00, 0x0082, 0x1500, 0x0008, 0x2280, 0x0082, 0x1300, 0x0003, 0x0200, 0x0081, 0x1380, 0x0008, 0x2c00, 0x0081, 0x0280,
+    0x0002, 0x0c80, 0x008f, 0x1f80, 0x0003, 0x0a80, 0x0082, 0x1c00, 0x0009, 0x2680, 0x1280, 0x0089, 0x0c00, 0x0004, 0x0580, 0x0081,
+    0x4700, 0x0006, 0x1180, 0x0082, 0x0006, 0x0900, 0x0082, 0x0400, 0x0002, 0x1e00, 0x008f, 0x0900, 0x0103, 0x0380, 0x0081, 0x0a00,
+    0x0000, 0x0b80, 0x0085, 0x0200, 0x2800, 0x2680, 0x0002, 0x0e00, 0x1580, 0x0091, 0x1480, 0x0000, 0x0a00, 0x0081, 0x0200, 0x0087,
+    0x0c80, 0x0000, 0x0300, 0x0080, 0x5b80, 0x0101, 0x1d80, 0x0004, 0x1d00, 0x0082, 0x1880, 0x0008, 0x2f80, 0x0082, 0x1c80, 0x0003,
+    0x0200, 0x0081, 0x0800, 0x0008, 0x1200, 0x0082, 0x0002, 0x0700, 0x008f, 0x1900, 0x0003, 0x0a80, 0x0082, 0x1300, 0x0008, 0x0c00,
+    0x008b, 0x0c00, 0x0004, 0x0580, 0x0081, 0x3000, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0002, 0x1b00,
+    0x008f, 0x0a80, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0b80, 0x0084, 0x0301, 0x0081, 0x1380, 0x0500, 0x0002, 0x1e00, 0x1080,
+    0x008f, 0x1480, 0x0000, 0x0780, 0x0080, 0x0280, 0x0480, 0x0087, 0x1800, 0x0000, 0x0300, 0x0080, 0x5b00, 0x0101, 0x1d80, 0x0004,
+    0x2680, 0x0082, 0x2f80, 0x0008, 0x1500, 0x0082, 0x1480, 0x0003, 0x0200, 0x0081, 0x0800, 0x0008, 0x0580, 0x0081, 0x0200, 0x0002,
+    0x0500, 0x0082, 0x0580, 0x078b, 0x1b00, 0x0003, 0x0a80, 0x0082, 0x0e80, 0x0007, 0x1e00, 0x0082, 0x0480, 0x2f80, 0x1c00, 0x0700,
+    0x0d00, 0x0e00, 0x3400, 0x0082, 0x0c00, 0x0004, 0x0580, 0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082,
+    0x0400, 0x0002, 0x0a00, 0x0082, 0x4700, 0x078b, 0x1400, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0b80, 0x0084, 0x0200, 0x0083,
+    0x0280, 0x0c00, 0x0f00, 0x0001, 0x0b80, 0x008f, 0x1400, 0x0000, 0x1900, 0x0080, 0x0480, 0x0300, 0x0087, 0x1800, 0x0000, 0x0280,
+    0x0080, 0x5b00, 0x0101, 0x4a80, 0x0004, 0x1480, 0x0082, 0x1000, 0x0008, 0x1f00, 0x0082, 0x0e00, 0x0003, 0x0200, 0x0081, 0x0800,
+    0x0007, 0x0600, 0x0280, 0x0081, 0x2800, 0x0002, 0x1800, 0x0082, 0x0b00, 0x0010, 0x0a80, 0x0082, 0x0e80, 0x0007, 0x2800, 0x0081,
+    0x0480, 0x0500, 0x0004, 0x0600, 0x0082, 0x0c00, 0x0004, 0x0580, 0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900,
+    0x0082, 0x0400, 0x0002, 0x1d00, 0x0082, 0x1e80, 0x000c, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0083, 0x0300, 0x0480,
+    0x0085, 0x1080, 0x3400, 0x0000, 0x0c80, 0x008f, 0x1400, 0x0000, 0x1900, 0x0080, 0x0200, 0x0088, 0x0f80, 0x0000, 0x0280, 0x0080,
+    0x4d80, 0x0101, 0x4a80, 0x0004, 0x0c80, 0x0082, 0x3000, 0x0008, 0x2780, 0x0082, 0x0f00, 0x0003, 0x0200, 0x0081, 0x0800, 0x0007,
+    0x1480, 0x0082, 0x1180, 0x0003, 0x0480, 0x0081, 0x0580, 0x0010, 0x0a80, 0x0082, 0x0e80, 0x0006, 0x0d00, 0x0082, 0x1500, 0x0005,
+    0x0600, 0x0082, 0x0c00, 0x0004, 0x0580, 0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0002,
+    0x0400, 0x0082, 0x1180, 0x000c, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0083, 0x0200, 0x0280, 0x0086, 0x1f00, 0x0000,
+    0x0c80, 0x008f, 0x1300, 0x0000, 0x1900, 0x0280, 0x0480, 0x0088, 0x0f80, 0x0000, 0x0081, 0x4d80, 0x0101, 0x3a00, 0x0005, 0x0580,
+    0x0081, 0x0280, 0x0f00, 0x0006, 0x0f80, 0x0082, 0x2780, 0x0004, 0x0200, 0x0081, 0x0800, 0x0007, 0x0780, 0x0082, 0x0980, 0x0003,
+    0x0800, 0x0082, 0x0700, 0x000f, 0x0a80, 0x0082, 0x0e80, 0x0006, 0x0e80, 0x0082, 0x1b00, 0x0005, 0x0600, 0x0082, 0x0c00, 0x0004,
+    0x0580, 0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0002, 0x0880, 0x0300, 0x0081, 0x1080,
+    0x0880, 0x000b, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0082, 0x0280, 0x0480, 0x0087, 0x1000, 0x0000, 0x0c80, 0x008f,
+    0x1300, 0x0000, 0x1f80, 0x0301, 0x0085, 0x0280, 0x0081, 0x0680, 0x0000, 0x0081, 0x4d00, 0x0101, 0x3a00, 0x0005, 0x2f80, 0x0082,
+    0x0900, 0x0006, 0x1e80, 0x0082, 0x0900, 0x0004, 0x0200, 0x0081, 0x0800, 0x0006, 0x1480, 0x0082, 0x0200, 0x0f00, 0x0003, 0x0d80,
+    0x0082, 0x1900, 0x000f, 0x0a80, 0x0082, 0x0e80, 0x0006, 0x0700, 0x0082, 0x1880, 0x0005, 0x0600, 0x0082, 0x0c00, 0x0004, 0x0580,
+    0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0003, 0x1f00, 0x0082, 0x0a80, 0x000b, 0x0103,
+    0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0082, 0x0301, 0x0087, 0x1000, 0x0000, 0x0c80, 0x008f, 0x1300, 0x0000, 0x1f80, 0x0301,
+    0x0083, 0x0300, 0x0201, 0x0300, 0x0080, 0x0680, 0x0000, 0x0081, 0x4d00, 0x0101, 0x4200, 0x0005, 0x0d00, 0x0300, 0x0081, 0x0300,
+    0x0e00, 0x0004, 0x1400, 0x0280, 0x0081, 0x0480, 0x0f80, 0x0004, 0x0200, 0x0081, 0x0800, 0x0005, 0x1c00, 0x0480, 0x0082, 0x4c00,
+    0x0004, 0x0600, 0x0580, 0x0082, 0x2280, 0x0600, 0x0006, 0x0f80, 0x0005, 0x0a80, 0x0082, 0x0e80, 0x0006, 0x0600, 0x0300, 0x0081,
+    0x0580, 0x0f80, 0x0004, 0x0600, 0x0082, 0x0c00, 0x0004, 0x0580, 0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900,
+    0x0082, 0x0400, 0x0003, 0x0400, 0x0082, 0x0280, 0x0980, 0x0007, 0x0f80, 0x0001, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500,
+    0x0082, 0x0200, 0x0088, 0x1000, 0x0000, 0x0d00, 0x008f, 0x0e80, 0x0000, 0x2000, 0x0280, 0x0480, 0x0081, 0x0300, 0x0200, 0x0300,
+    0x0080, 0x0301, 0x0080, 0x0f00, 0x0880, 0x0081, 0x3500, 0x0101, 0x4200, 0x0006, 0x0900, 0x0082, 0x0280, 0x0c00, 0x1480, 0x0400,
+    0x1c00, 0x2280, 0x0280, 0x0082, 0x0980, 0x0005, 0x0200, 0x0081, 0x0200, 0x1b80, 0x0a00, 0x1d01, 0x0900, 0x1380, 0x0083, 0x1380,
+    0x0006, 0x1480, 0x0083, 0x1080, 0x2280, 0x0d80, 0x1c80, 0x1d00, 0x1b00, 0x0c00, 0x1200, 0x0080, 0x0f80, 0x0004, 0x0a80, 0x0082,
+    0x0e80, 0x0007, 0x1f00, 0x0082, 0x1280, 0x4580, 0x1480, 0x0e00, 0x1400, 0x3400, 0x1e80, 0x0082, 0x0c00, 0x0004, 0x0580, 0x0081,
+    0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0004, 0x1880, 0x0083, 0x1200, 0x1880, 0x1d00, 0x1c80,
+    0x1e00, 0x0a80, 0x1000, 0x0580, 0x1200, 0x0001, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0081, 0x0280, 0x0480, 0x0088,
+    0x1000, 0x0000, 0x0d00, 0x008f, 0x0e80, 0x0000, 0x2000, 0x0080, 0x0480, 0x0201, 0x0300, 0x0082, 0x0480, 0x0280, 0x0080, 0x0f00,
+    0x0880, 0x0081, 0x3500, 0x0101, 0x4200, 0x0007, 0x1500, 0x008a, 0x1e80, 0x0006, 0x0200, 0x008b, 0x2000, 0x0f00, 0x0007, 0x1e00,
+    0x0280, 0x008a, 0x1d00, 0x0004, 0x0a80, 0x0082, 0x0e80, 0x0007, 0x1800, 0x1280, 0x008b, 0x0c00, 0x0004, 0x0580, 0x0081, 0x0b00,
+    0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0005, 0x1500, 0x008b, 0x1800, 0x0000, 0x0103, 0x0380, 0x0081,
+    0x0a00, 0x0000, 0x0500, 0x0081, 0x0301, 0x0088, 0x1000, 0x0000, 0x0d00, 0x008f, 0x0e80, 0x0000, 0x2000, 0x0087, 0x0200, 0x0081,
+    0x0601, 0x0081, 0x5a00, 0x0101, 0x3980, 0x0008, 0x1e00, 0x1080, 0x0086, 0x0580, 0x2680, 0x0007, 0x0200, 0x0089, 0x1280, 0x0a00,
+    0x000a, 0x0700, 0x2000, 0x0089, 0x0980, 0x0004, 0x0a80, 0x0082, 0x0e80, 0x0008, 0x0c80, 0x0800, 0x008a, 0x1e80, 0x0004, 0x0580,
+    0x0081, 0x0b00, 0x0006, 0x1180, 0x0081, 0x0280, 0x0006, 0x0900, 0x0082, 0x0400, 0x0006, 0x3400, 0x1200, 0x0088, 0x0300, 0x0700,
+    0x0000, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0081, 0x0200, 0x0089, 0x1b80, 0x0000, 0x0d00, 0x008f, 0x0e00, 0x0000,
+    0x0800, 0x0086, 0x0280, 0x0200, 0x0081, 0x0601, 0x0081, 0x5a00, 0x0101, 0x3980, 0x0009, 0x0600, 0x1c80, 0x1500, 0x1f80, 0x1380,
+    0x1900, 0x1500, 0x1c00, 0x0600, 0x0008, 0x0200, 0x0081, 0x1200, 0x1880, 0x1900, 0x1380, 0x0800, 0x1180, 0x1e80, 0x1400, 0x0880,
+    0x000d, 0x0b80, 0x0a00, 0x1000, 0x1f80, 0x1380, 0x1f80, 0x1000, 0x2f80, 0x1d00, 0x1800, 0x0005, 0x0500, 0x1b00, 0x0900, 0x0a00,
+    0x0680, 0x000a, 0x0500, 0x0900, 0x1000, 0x2000, 0x0b00, 0x0800, 0x1900, 0x0c00, 0x0a00, 0x0e80, 0x0f00, 0x0005, 0x2680, 0x0901,
+    0x1c00, 0x0006, 0x1300, 0x0a80, 0x0900, 0x0d80, 0x0006, 0x0500, 0x0a80, 0x0900, 0x0a00, 0x0680, 0x0008, 0x0e80, 0x4c00, 0x1f00,
+    0x2000, 0x1380, 0x1900, 0x1b80, 0x1e80, 0x1c80, 0x0f00, 0x0001, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0081, 0x0200,
+    0x0084, 0x0280, 0x0481, 0x0081, 0x1b80, 0x0000, 0x0b80, 0x008f, 0x0e00, 0x0000, 0x0800, 0x0086, 0x0301, 0x0081, 0x0880, 0x0f00,
+    0x0081, 0x4500, 0x0101, 0x3980, 0x001b, 0x0200, 0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0a00, 0x0000, 0x0500, 0x0081,
+    0x0200, 0x0082, 0x0280, 0x0481, 0x0280, 0x0200, 0x0081, 0x1b80, 0x0000, 0x0b80, 0x008f, 0x0400, 0x0000, 0x0800, 0x0086, 0x0200,
+    0x0082, 0x0880, 0x0f00, 0x0081, 0x4500, 0x0101, 0x3980, 0x001b, 0x0200, 0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0a00,
+    0x0000, 0x0500, 0x0081, 0x0300, 0x0480, 0x0300, 0x0480, 0x0200, 0x0280, 0x0081, 0x0200, 0x0081, 0x1b80, 0x0000, 0x0b80, 0x008f,
+    0x0400, 0x0000, 0x1380, 0x0085, 0x0280, 0x0480, 0x0082, 0x0000, 0x0680, 0x0081, 0x4500, 0x0101, 0x2600, 0x001b, 0x0200, 0x0081,
+    0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0082, 0x0301, 0x0280, 0x0082, 0x0280, 0x0480, 0x0081, 0x1b80,
+    0x0000, 0x0b80, 0x008f, 0x0400, 0x0000, 0x1380, 0x0085, 0x0480, 0x0280, 0x0082, 0x0000, 0x0680, 0x0081, 0x4480, 0x0101, 0x2600,
+    0x001b, 0x0200, 0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0088, 0x0301, 0x0081, 0x2280, 0x0000,
+    0x0500, 0x008f, 0x0700, 0x0000, 0x0b00, 0x0085, 0x0200, 0x0083, 0x0000, 0x0f80, 0x0081, 0x4480, 0x0101, 0x2600, 0x001b, 0x0200,
+    0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0088, 0x0200, 0x0280, 0x0081, 0x2280, 0x0000, 0x0500,
+    0x008f, 0x0700, 0x0000, 0x0b00, 0x0085, 0x0200, 0x0082, 0x0280, 0x0000, 0x0f80, 0x0081, 0x4480, 0x0101, 0x2f00, 0x001b, 0x0200,
+    0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0087, 0x0280, 0x0200, 0x0082, 0x2280, 0x0000, 0x0500,
+    0x008f, 0x0700, 0x0000, 0x0b00, 0x0084, 0x0280, 0x0480, 0x0082, 0x0280, 0x0000, 0x1800, 0x0081, 0x4480, 0x0101, 0x2f00, 0x001b,
+    0x0200, 0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0087, 0x0480, 0x0300, 0x0082, 0x2280, 0x0000,
+    0x0500, 0x008f, 0x0500, 0x0000, 0x3000, 0x0084, 0x0301, 0x0082, 0x0300, 0x0000, 0x1800, 0x0081, 0x7880, 0x0101, 0x2f00, 0x001b,
+    0x0200, 0x0081, 0x0800, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0087, 0x0200, 0x0083, 0x1500, 0x0000, 0x0500,
+    0x0086, 0x7c00, 0x5e80, 0x0086, 0x0500, 0x0000, 0x3000, 0x0084, 0x0301, 0x0082, 0x0300, 0x0000, 0x0c80, 0x0081, 0x3b80, 0x0101,
+    0x2f00, 0x001b, 0x0500, 0x1400, 0x1300, 0x0c80, 0x0076, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0086, 0x0280, 0x0480,
+    0x0083, 0x1500, 0x0000, 0x0700, 0x0086, 0x8380, 0x3900, 0x7d80, 0x0085, 0x0b80, 0x0000, 0x1580, 0x0084, 0x0480, 0x0280, 0x0082,
+    0x0480, 0x0000, 0x0c80, 0x0081, 0x3b80, 0x0101, 0x3880, 0x007f, 0x0016, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0086,
+    0x0301, 0x0083, 0x1500, 0x0000, 0x0700, 0x0087, 0x4c80, 0x0180, 0x5780, 0x4780, 0x0083, 0x0b80, 0x0000, 0x1580, 0x0084, 0x0480,
+    0x0280, 0x0082, 0x0480, 0x0000, 0x0d00, 0x0081, 0x3b80, 0x0101, 0x3880, 0x007f, 0x0016, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000,
+    0x0700, 0x0086, 0x0480, 0x0280, 0x0083, 0x1500, 0x0000, 0x0700, 0x0088, 0x5900, 0x0180, 0x3900, 0x7a80, 0x8900, 0x0081, 0x0b80,
+    0x0000, 0x0b00, 0x0084, 0x0200, 0x0083, 0x0480, 0x0000, 0x0d00, 0x0081, 0x3480, 0x0101, 0x3880, 0x0002, 0x2c80, 0x3d80, 0x2080,
+    0x4880, 0x2e80, 0x1701, 0x5380, 0x3700, 0x2d80, 0x3600, 0x007f, 0x0008, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0086,
+    0x0200, 0x0084, 0x1500, 0x0000, 0x0700, 0x0088, 0x0280, 0x7680, 0x0181, 0x3a80, 0x5c00, 0x0280, 0x0d00, 0x0000, 0x0600, 0x4580,
+    0x0300, 0x0082, 0x0200, 0x0083, 0x0200, 0x0000, 0x0b80, 0x0081, 0x3480, 0x0101, 0x6680, 0x2900, 0x1780, 0x1980, 0x018a, 0x2180,
+    0x4900, 0x2400, 0x007f, 0x0005, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0700, 0x0086, 0x0200, 0x0084, 0x0c00, 0x0000, 0x0400,
+    0x008a, 0x7d00, 0x3900, 0x0181, 0x3a80, 0x7180, 0x6080, 0x0001, 0x0d00, 0x0780, 0x0081, 0x0200, 0x0083, 0x0200, 0x0000, 0x0b80,
+    0x0080, 0x5000, 0x7280, 0x5580, 0x5500, 0x0191, 0x1a00, 0x1680, 0x1600, 0x007f, 0x0002, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000,
+    0x0400, 0x0086, 0x0200, 0x0084, 0x0c00, 0x0000, 0x0400, 0x008b, 0x4e00, 0x7000, 0x0183, 0x6a00, 0x1700, 0x2d80, 0x3100, 0x0e00,
+    0x0b00, 0x0200, 0x0083, 0x8700, 0x2880, 0x6980, 0x7480, 0x3900, 0x0196, 0x1a00, 0x2900, 0x007f, 0x0001, 0x0103, 0x0380, 0x0081,
+    0x0980, 0x0000, 0x0700, 0x0085, 0x0280, 0x0480, 0x0084, 0x0c00, 0x0000, 0x0400, 0x008d, 0x5d00, 0x6f00, 0x0185, 0x3800, 0x2a00,
+    0x6d80, 0x7600, 0x4c80, 0x7a00, 0x4b80, 0x5600, 0x018d, 0x1a80, 0x1a00, 0x1980, 0x2580, 0x2180, 0x1a80, 0x0188, 0x2580, 0x3e00,
+    0x007f, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0400, 0x0085, 0x0280, 0x0480, 0x0083, 0x4700, 0x1800, 0x0000, 0x1c00, 0x008e,
+    0x0280, 0x5d00, 0x5700, 0x0192, 0x6500, 0x2100, 0x1680, 0x2080, 0x3e00, 0x5100, 0x1600, 0x0005, 0x3100, 0x3200, 0x1680, 0x2500,
+    0x1a80, 0x0185, 0x4900, 0x1600, 0x007d, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0400, 0x0085, 0x0301, 0x0082, 0x1580, 0x0680,
+    0x0000, 0x1300, 0x0480, 0x0084, 0x4780, 0x8780, 0x008a, 0x8580, 0x7e00, 0x5700, 0x018a, 0x4a00, 0x4b80, 0x6f80, 0x6a80, 0x6c00,
+    0x3380, 0x000f, 0x2c80, 0x2900, 0x2580, 0x0184, 0x2580, 0x3c80, 0x007c, 0x0103, 0x0380, 0x0081, 0x0980, 0x0000, 0x0400, 0x0085,
+    0x0301, 0x0081, 0x2000, 0x0600, 0x0000, 0x1c00, 0x0300, 0x0085, 0x7900, 0x5780, 0x008d, 0x5000, 0x4e00, 0x5c80, 0x7c80, 0x7100,
+    0x6180, 0x2e80, 0x3280, 0x6600, 0x2400, 0x6d00, 0x0081, 0x7580, 0x0101, 0x6300, 0x0012, 0x3700, 0x1a00, 0x0183, 0x3800, 0x2880,
+    0x007b, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0085, 0x0301, 0x0080, 0x1180, 0x0880, 0x0000, 0x1d00, 0x0280, 0x0086,
+    0x4c80, 0x0180, 0x8000, 0x0091, 0x1280, 0x0980, 0x0002, 0x0400, 0x0081, 0x7500, 0x0101, 0x4100, 0x0013, 0x2380, 0x2100, 0x0183,
+    0x1a00, 0x3c80, 0x007a, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0085, 0x0480, 0x0280, 0x2280, 0x0001, 0x0a00, 0x0088,
+    0x8200, 0x0180, 0x3a80, 0x8880, 0x0092, 0x2780, 0x1400, 0x0000, 0x0e00, 0x0081, 0x4400, 0x0101, 0x4100, 0x0015, 0x3280, 0x1100,
+    0x0182, 0x2180, 0x2c80, 0x0079, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0085, 0x0480, 0x1880, 0x0001, 0x0900, 0x0089,
+    0x5000, 0x4a00, 0x0180, 0x5900, 0x0094, 0x1900, 0x1e00, 0x0081, 0x4400, 0x0101, 0x4100, 0x0016, 0x2080, 0x1100, 0x0182, 0x1780,
+    0x0079, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0085, 0x0a00, 0x0001, 0x0c00, 0x008b, 0x5980, 0x0181, 0x5c00, 0x0097,
+    0x4400, 0x0101, 0x2980, 0x0017, 0x2080, 0x0183, 0x2d80, 0x0078, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0083, 0x0280,
+    0x2680, 0x0001, 0x1000, 0x008c, 0x5e80, 0x0181, 0x4a00, 0x8500, 0x0092, 0x4f80, 0x8400, 0x7b80, 0x4300, 0x0102, 0x2980, 0x0002,
+    0x2880, 0x2900, 0x1681, 0x2080, 0x3100, 0x000f, 0x1680, 0x0182, 0x1a00, 0x2380, 0x0014, 0x3600, 0x2400, 0x3280, 0x4980, 0x2481,
+    0x1700, 0x2900, 0x2880, 0x0059, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0400, 0x0082, 0x0300, 0x1c00, 0x0000, 0x0880, 0x1900,
+    0x008e, 0x4b80, 0x0181, 0x3a80, 0x4780, 0x008d, 0x5f80, 0x8180, 0x7780, 0x5680, 0x0106, 0x2980, 0x2380, 0x1680, 0x1980, 0x0184,
+    0x1100, 0x3300, 0x3180, 0x000e, 0x1780, 0x0182, 0x1700, 0x0012, 0x3d80, 0x2a00, 0x0188, 0x2180, 0x2080, 0x0057, 0x0103, 0x0380,
+    0x0081, 0x0d80, 0x0000, 0x0400, 0x0081, 0x0200, 0x0e80, 0x0000, 0x0f00, 0x0800, 0x008f, 0x4780, 0x3900, 0x0181, 0x3a80, 0x4e00,
+    0x0088, 0x5f00, 0x5b80, 0x7400, 0x4b00, 0x010a, 0x6380, 0x1a80, 0x0188, 0x1a80, 0x3280, 0x000d, 0x2380, 0x1a00, 0x0181, 0x1a80,
+    0x3180, 0x0010, 0x2900, 0x1100, 0x018b, 0x2100, 0x2c80, 0x0055, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0e00, 0x0080, 0x0580,
+    0x0700, 0x0000, 0x0680, 0x1580, 0x0091, 0x7e80, 0x0182, 0x5600, 0x5c80, 0x0082, 0x3080, 0x2b80, 0x4d80, 0x7300, 0x010b, 0x2b00,
+    0x3880, 0x6200, 0x6400, 0x0184, 0x1a80, 0x2100, 0x2480, 0x2500, 0x1a80, 0x0182, 0x1780, 0x000d, 0x2080, 0x0182, 0x2480, 0x000f,
+    0x3180, 0x1100, 0x2180, 0x2100, 0x2480, 0x1700, 0x2e80, 0x1680, 0x2e80, 0x4900, 0x2a00, 0x1100, 0x0183, 0x4180, 0x1600, 0x0054,
+    0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x0e00, 0x2c00, 0x0d00, 0x0000, 0x0c80, 0x2800, 0x0093, 0x5980, 0x0183, 0x7080, 0x7800,
+    0x4300, 0x010b, 0x1d80, 0x2a80, 0x3780, 0x2d00, 0x1600, 0x2e80, 0x1100, 0x0183, 0x2a00, 0x2d80, 0x1600, 0x0002, 0x2380, 0x2e80,
+    0x1100, 0x0181, 0x1700, 0x000d, 0x2500, 0x0182, 0x2880, 0x000e, 0x1600, 0x3180, 0x0008, 0x3100, 0x3300, 0x0183, 0x2480, 0x0054,
+    0x0103, 0x0380, 0x0081, 0x0d80, 0x0000, 0x1800, 0x0f80, 0x0000, 0x0500, 0x1280, 0x0094, 0x8600, 0x7200, 0x0184, 0x6700, 0x6b00,
+    0x0106, 0x1d80, 0x3380, 0x5400, 0x2d00, 0x0002, 0x2900, 0x1980, 0x0183, 0x2580, 0x2400, 0x0007, 0x3200, 0x1a80, 0x0181, 0x2400,
+    0x000c, 0x5180, 0x0182, 0x2500, 0x001b, 0x3700, 0x0183, 0x3e80, 0x0053, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0002, 0x0400, 0x1080,
+    0x0091, 0x4e80, 0x7f80, 0x5880, 0x4b00, 0x0100, 0x6c80, 0x5580, 0x0185, 0x5500, 0x6800, 0x6b80, 0x6880, 0x3380, 0x2e00, 0x3d00,
+    0x0002, 0x1600, 0x2400, 0x1700, 0x1a00, 0x0184, 0x1700, 0x1600, 0x0009, 0x3e00, 0x1a80, 0x0180, 0x2580, 0x000d, 0x1780, 0x0182,
+    0x3e80, 0x001b, 0x1680, 0x0182, 0x4080, 0x0053, 0x0103, 0x0380, 0x0081, 0x0d80, 0x0001, 0x1400, 0x0480, 0x008d, 0x3080, 0x2b80,
+    0x5a80, 0x5800, 0x0107, 0x6900, 0x6580, 0x0187, 0x2580, 0x2100, 0x1780, 0x3300, 0x2500, 0x2180, 0x1100, 0x0185, 0x1a00, 0x2400,
+    0x000c, 0x2080, 0x0181, 0x3e80, 0x000c, 0x3c80, 0x1100, 0x0181, 0x2580, 0x5080, 0x001b, 0x2a00, 0x0182, 0x2880, 0x0052, 0x0103,
+    0x0380, 0x0081, 0x0d80, 0x0000, 0x3400, 0x0280, 0x008a, 0x4f80, 0x5e00, 0x7b00, 0x4300, 0x010c, 0x6780, 0x6480, 0x0192, 0x2500,
+    0x3600, 0x000e, 0x1700, 0x0180, 0x1780, 0x000d, 0x4980, 0x0182, 0x2e80, 0x001b, 0x2080, 0x0182, 0x1680, 0x0052, 0x0103, 0x0380,
+    0x0081, 0x0d80, 0x1e00, 0x0280, 0x0087, 0x5f80, 0x8100, 0x7700, 0x5680, 0x010b, 0x2200, 0x4200, 0x2980, 0x5280, 0x2300, 0x0001,
+    0x3e80, 0x4080, 0x018e, 0x1980, 0x2d80, 0x0011, 0x2100, 0x1980, 0x000d, 0x3600, 0x1a80, 0x0181, 0x1100, 0x2880, 0x001a, 0x2c80,
+    0x1100, 0x0181, 0x1780, 0x0052, 0x0103, 0x0380, 0x0081, 0x0b00, 0x0085, 0x4e80, 0x7f00, 0x5880, 0x4b00, 0x010b, 0x2200, 0x2600,
+    0x4000, 0x5280, 0x2300, 0x0007, 0x3d80, 0x1700, 0x1980, 0x0189, 0x4180, 0x3f00, 0x1600, 0x0012, 0x1600, 0x3280, 0x000e, 0x3280,
+    0x0182, 0x2180, 0x2380, 0x001a, 0x2580, 0x0181, 0x2a00, 0x0052, 0x0103, 0x0380, 0x0083, 0x3080, 0x2b80, 0x5a80, 0x5800, 0x010c,
+    0x2200, 0x2600, 0x5480, 0x3680, 0x0880, 0x000e, 0x5100, 0x2d80, 0x1680, 0x4980, 0x1780, 0x2480, 0x1700, 0x3700, 0x3200, 0x3600,
+    0x0026, 0x5080, 0x2180, 0x0182, 0x2500, 0x001a, 0x2a00, 0x0181, 0x6280, 0x0052, 0x0103, 0x0380, 0x4f80, 0x5e00, 0x7980, 0x4300,
+    0x010c, 0x2b00, 0x2f00, 0x5480, 0x4800, 0x0880, 0x0044, 0x5180, 0x1100, 0x0182, 0x2480, 0x0019, 0x1980, 0x0181, 0x2480, 0x0052,
+    0x0103, 0x2200, 0x010c, 0x2b00, 0x2a80, 0x5400, 0x5200, 0x004a, 0x4880, 0x0183, 0x2100, 0x2380, 0x0016, 0x3c80, 0x0182, 0x2080,
+    0x0052, 0x010d, 0x2b00, 0x3880, 0x3780, 0x5200, 0x004f, 0x1780, 0x0183, 0x1980, 0x2400, 0x0015, 0x1780, 0x0181, 0x1100, 0x2380,
+    0x0052, 0x0109, 0x1d80, 0x2a80, 0x3780, 0x2d00, 0x0054, 0x1780, 0x0184, 0x2100, 0x3180, 0x0012, 0x1680, 0x0182, 0x3300, 0x0053,
+    0x0105, 0x1d80, 0x3380, 0x2e00, 0x3d00, 0x0059, 0x1680, 0x1100, 0x0183, 0x1100, 0x1780, 0x3200, 0x000e, 0x2380, 0x3300, 0x0182,
+    0x3800, 0x3100, 0x0053, 0x0101, 0x3a00, 0x4100, 0x2e00, 0x6000, 0x005e, 0x3d80, 0x1980, 0x0185, 0x1a80, 0x1780, 0x4880, 0x3e00,
+    0x3100, 0x0006, 0x2c80, 0x2400, 0x1700, 0x3800, 0x0182, 0x1100, 0x2d80, 0x0054, 0x6100, 0x3c00, 0x0063, 0x1600, 0x3f00, 0x1980,
+    0x0188, 0x1a80, 0x1980, 0x4080, 0x2a00, 0x2500, 0x4180, 0x3800, 0x0186, 0x2900, 0x007f, 0x003d, 0x1600, 0x3f00, 0x2180, 0x0192,
+    0x1a00, 0x3200, 0x007f, 0x0041, 0x2880, 0x5380, 0x4180, 0x018d, 0x4080, 0x3700, 0x1600, 0x007f, 0x0045, 0x2c80, 0x3200, 0x1680,
+    0x3300, 0x2500, 0x1980, 0x1a02, 0x2180, 0x2100, 0x1700, 0x3f00, 0x3180, 0x005a,
+};
+
+const OperameImage::Image OPERAME_LOGO = {
+    215, 76, OPERAME_LOGO_PALETTE, OPERAME_LOGO_RUNS, 3370
+};
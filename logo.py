@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# Converts logo.png into logo.h: a palette plus run-length encoded pixels
+# that OperameImage::draw() decodes straight into the sprite.
+#
+# Runs as a PlatformIO pre-build script, regenerating logo.h whenever
+# logo.png is newer, or by hand with: python3 logo.py [input.png] [output.h]
+#
+# Each run is one 16-bit word: palette index << 7 | (length - 1).
+
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 128
+MAX_COLOURS = 512
+
+
+def read_png(path):
+    """Returns (width, height, rows of (r, g, b)) for a non-interlaced 8-bit PNG."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(path + " is not a PNG file")
+
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+        pos += 12 + length
+
+    channels = {2: 3, 6: 4}.get(colour)
+    if depth != 8 or not channels or interlace:
+        raise ValueError(path + ": only non-interlaced 8-bit RGB(A) is supported")
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        start = y * (stride + 1)
+        kind, line = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if kind == 1:
+                line[x] = (line[x] + a) & 0xff
+            elif kind == 2:
+                line[x] = (line[x] + b) & 0xff
+            elif kind == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[x] = (line[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        rows.append([tuple(line[x:x + 3]) for x in range(0, stride, channels)])
+        prev = line
+    return width, height, rows
+
+
+def rgb565(r, g, b):
+    return (r >> 3) << 11 | (g >> 2) << 5 | b >> 3
+
+
+def encode(pixels):
+    runs = []
+    for colour in pixels:
+        if runs and runs[-1][0] == colour and runs[-1][1] < MAX_RUN:
+            runs[-1][1] += 1
+        else:
+            runs.append([colour, 1])
+
+    # Most frequent colours first, which keeps the output stable
+    counts = {}
+    for colour in pixels:
+        counts[colour] = counts.get(colour, 0) + 1
+    palette = sorted(counts, key=lambda c: (-counts[c], c))
+    if len(palette) > MAX_COLOURS:
+        raise ValueError("too many colours: %d, at most %d" % (len(palette), MAX_COLOURS))
+
+    index = {colour: i for i, colour in enumerate(palette)}
+    return palette, [index[colour] << 7 | (length - 1) for colour, length in runs]
+
+
+def decode(palette, runs):
+    pixels = []
+    for run in runs:
+        pixels += [palette[run >> 7]] * ((run & 0x7f) + 1)
+    return pixels
+
+
+def words(values):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append("    " + ", ".join("0x%04x" % v for v in values[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def convert(source, target):
+    width, height, rows = read_png(source)
+    pixels = [rgb565(*p) for row in rows for p in row]
+    palette, runs = encode(pixels)
+    assert decode(palette, runs) == pixels
+
+    size = 2 * (len(palette) + len(runs))
+    with open(target, "w") as f:
+        f.write("""// Generated by logo.py from %s; do not edit.
+// %dx%d pixels, %d colours, %d runs: %d bytes instead of %d as raw RGB565.
+
+#include <operame_image.h>
+
+const uint16_t OPERAME_LOGO_PALETTE[%d] PROGMEM = {
+%s
+};
+
+const uint16_t OPERAME_LOGO_RUNS[%d] PROGMEM = {
+%s
+};
+
+const OperameImage::Image OPERAME_LOGO = {
+    %d, %d, OPERAME_LOGO_PALETTE, OPERAME_LOGO_RUNS, %d
+};
+""" % (os.path.basename(source), width, height, len(palette), len(runs), size, 2 * width * height,
+       len(palette), words(palette), len(runs), words(runs), width, height, len(runs)))
+    print("%s: %d bytes (raw %d)" % (target, size, 2 * width * height))
+
+
+def outdated(source, target):
+    return not os.path.exists(target) or os.path.getmtime(source) > os.path.getmtime(target)
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    convert(args[0] if args else "logo.png", args[1] if len(args) > 1 else "logo.h")
+else:
+    Import("env")  # noqa: F821, PlatformIO
+    project = env.subst("$PROJECT_DIR")  # noqa: F821
+    source, target = os.path.join(project, "logo.png"), os.path.join(project, "logo.h")
+    if outdated(source, target):
+        convert(source, target)
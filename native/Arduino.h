@@ -0,0 +1,275 @@
+#pragma once
+// Host stand-in for the parts of the Arduino-ESP32 core that Operame uses.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cmath>
+#include <string>
+#include <deque>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+#define HIGH            1
+#define LOW             0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+#define SERIAL_8N1      0x800001c
+#define RISING          0x01
+#define FALLING         0x02
+#define CHANGE          0x03
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*) (addr))
+#define pgm_read_word(addr) (*(const uint16_t*) (addr))
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+
+#define digitalPinToInterrupt(p) (p)
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+namespace hal {
+    // Input levels as seen by digitalRead(); set by the host runner.
+    extern int pin_level[40];
+
+    // Changes an input level, calling its interrupt handler like the GPIO
+    // peripheral would.
+    void set_pin(uint8_t pin, int level);
+
+    // Set in simulations: the clock is virtual and tasks take turns, each
+    // running until it calls delay().
+    extern bool simulated;
+
+    // Runs `body` forever as a firmware task.
+    void start_task(const char* name, void (*body)());
+}
+
+class String {
+  public:
+    String(const char* s = "") : s_(s ? s : "") { }
+    String(const std::string& s) : s_(s) { }
+    explicit String(char c) : s_(1, c) { }
+    String(int v) : s_(std::to_string(v)) { }
+    String(unsigned int v) : s_(std::to_string(v)) { }
+    String(long v) : s_(std::to_string(v)) { }
+    String(unsigned long v) : s_(std::to_string(v)) { }
+    String(float v, unsigned char decimals = 2) : String((double) v, decimals) { }
+    String(double v, unsigned char decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        s_ = buf;
+    }
+
+    unsigned int length() const { return s_.length(); }
+    const char* c_str() const { return s_.c_str(); }
+    char charAt(unsigned int i) const { return i < s_.length() ? s_[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char& operator[](unsigned int i) { return s_[i]; }
+    bool isEmpty() const { return s_.empty(); }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        auto p = s_.find(c, from);
+        return p == std::string::npos ? -1 : (int) p;
+    }
+    int indexOf(const String& s, unsigned int from = 0) const {
+        auto p = s_.find(s.s_, from);
+        return p == std::string::npos ? -1 : (int) p;
+    }
+    String substring(unsigned int from) const {
+        return from < s_.length() ? String(s_.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= s_.length()) return String();
+        return String(s_.substr(from, to - from));
+    }
+    bool startsWith(const String& s) const { return s_.compare(0, s.s_.length(), s.s_) == 0; }
+    bool endsWith(const String& s) const {
+        return s_.length() >= s.s_.length()
+            && s_.compare(s_.length() - s.s_.length(), s.s_.length(), s.s_) == 0;
+    }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+
+    void replace(const String& from, const String& to) {
+        if (from.s_.empty()) return;
+        size_t p = 0;
+        while ((p = s_.find(from.s_, p)) != std::string::npos) {
+            s_.replace(p, from.s_.length(), to.s_);
+            p += to.s_.length();
+        }
+    }
+    void trim() {
+        size_t b = s_.find_first_not_of(" \t\r\n");
+        size_t e = s_.find_last_not_of(" \t\r\n");
+        s_ = b == std::string::npos ? "" : s_.substr(b, e - b + 1);
+    }
+    bool concat(const String& s) { s_ += s.s_; return true; }
+
+    String& operator+=(const String& s) { s_ += s.s_; return *this; }
+    String& operator+=(const char* s) { s_ += s; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+
+    bool operator==(const String& s) const { return s_ == s.s_; }
+    bool operator==(const char* s) const { return s_ == s; }
+    bool operator!=(const String& s) const { return s_ != s.s_; }
+    bool operator!=(const char* s) const { return s_ != s; }
+    bool operator<(const String& s) const { return s_ < s.s_; }
+
+  private:
+    std::string s_;
+};
+
+class Print {
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buf++);
+        return n;
+    }
+    size_t write(const char* s) { return write((const uint8_t*) s, strlen(s)); }
+
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t) c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(const T& v) { return print(v) + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (n < 0) return 0;
+        return write((const uint8_t*) buf, std::min<size_t>(n, sizeof(buf) - 1));
+    }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() { }
+
+    void setTimeout(unsigned long timeout) { timeout_ = timeout; }
+
+    size_t readBytes(uint8_t* buf, size_t length) {
+        size_t count = 0;
+        unsigned long start = millis();
+        while (count < length) {
+            int c = read();
+            if (c < 0) {
+                if (millis() - start >= timeout_) break;
+                yield();
+                continue;
+            }
+            buf[count++] = c;
+        }
+        return count;
+    }
+    size_t readBytes(char* buf, size_t length) { return readBytes((uint8_t*) buf, length); }
+
+    String readString() {
+        std::string s;
+        for (int c; (c = read()) >= 0; ) s += (char) c;
+        return String(s);
+    }
+
+  protected:
+    unsigned long timeout_ = 1000;
+};
+
+// UART 0 is the console (stdout). For the others the far end is a host-side
+// device emulator: bytes written are handed to `device`, the emulator answers
+// with inject(), and injected bytes only become available() once their
+// simulated arrival time has passed.
+class HardwareSerial : public Stream {
+  public:
+    explicit HardwareSerial(int uart_nr) : uart_nr_(uart_nr) { }
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rx = -1, int8_t tx = -1) {
+        baud_ = baud;
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override {
+        if (device) device(buf, size);
+        else if (uart_nr_ == 0) fwrite(buf, 1, size, stdout);
+        return size;
+    }
+    int available() override {
+        unsigned long now = millis();
+        int n = 0;
+        for (auto& b : rx_) {
+            if ((long) (now - b.second) < 0) break;
+            n++;
+        }
+        return n;
+    }
+    int read() override {
+        if (!available()) return -1;
+        int c = rx_.front().first;
+        rx_.pop_front();
+        return c;
+    }
+    int peek() override { return available() ? rx_.front().first : -1; }
+    void flush() override { if (uart_nr_ == 0) fflush(stdout); }
+
+    // Queues bytes from the emulated device, starting `delay_ms` from now and
+    // paced at roughly the configured baud rate.
+    void inject(const uint8_t* buf, size_t size, unsigned long delay_ms = 0) {
+        unsigned long t = millis() + delay_ms;
+        double per_byte = 10000.0 / baud_;  // 8N1: 10 bits per byte
+        for (size_t i = 0; i < size; i++) {
+            rx_.emplace_back(buf[i], t + (unsigned long) (i * per_byte));
+        }
+    }
+
+    std::function<void(const uint8_t*, size_t)> device;
+
+  private:
+    int uart_nr_;
+    unsigned long baud_ = 9600;
+    std::deque<std::pair<uint8_t, unsigned long>> rx_;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+  public:
+    [[noreturn]] void restart();
+    uint32_t getFreeHeap();
+    uint32_t getCycleCount();           // counts at getCpuFreqMHz(), like the ESP32
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern EspClass ESP;
@@ -0,0 +1,60 @@
+#pragma once
+// Host stand-in for WifWaf/MH-Z19, speaking the same UART frames as the real
+// library so that it can be driven by the emulated sensor.
+
+#include <Arduino.h>
+
+enum ERRORCODE {
+    RESULT_NULL = 0,
+    RESULT_OK = 1,
+    RESULT_TIMEOUT = 2,
+    RESULT_MATCH = 3,
+    RESULT_CRC = 4,
+    RESULT_FILTER = 5,
+    RESULT_FAILED = 6
+};
+
+class MHZ19 {
+  public:
+    void begin(Stream& stream) { serial = &stream; }
+    void autoCalibration(bool on = true, byte period = 24) { command(0x79, on ? 0xa0 : 0x00, false); }
+    void getVersion(char version[]) {
+        if (command(0xa0)) memcpy(version, response + 2, 4);
+    }
+    int getCO2(bool unlimited = true, bool force = true) {
+        if (unlimited) return command(0x85) ? response[4] << 8 | response[5] : 0;
+        return command(0x86) ? response[2] << 8 | response[3] : 0;
+    }
+    void calibrate() { command(0x87, 0, false); }
+
+    byte errorCode = RESULT_NULL;
+
+  private:
+    bool command(uint8_t cmd, uint8_t arg = 0, bool reply = true) {
+        uint8_t frame[9] = { 0xff, 0x01, cmd, arg, 0, 0, 0, 0, 0 };
+        frame[8] = checksum(frame);
+        while (serial->available()) serial->read();
+        serial->write(frame, sizeof(frame));
+        errorCode = RESULT_OK;
+        if (!reply) return true;
+
+        unsigned long start = millis();
+        while (serial->available() < 9) {
+            if (millis() - start >= 500) { errorCode = RESULT_TIMEOUT; return false; }
+            yield();
+        }
+        for (auto& b : response) b = serial->read();
+        if (response[0] != 0xff || response[1] != cmd) errorCode = RESULT_MATCH;
+        else if (response[8] != checksum(response)) errorCode = RESULT_CRC;
+        else errorCode = RESULT_OK;
+        return errorCode == RESULT_OK;
+    }
+    static uint8_t checksum(const uint8_t* frame) {
+        uint8_t sum = 0;
+        for (int i = 1; i < 8; i++) sum += frame[i];
+        return 0xff - sum + 1;
+    }
+
+    Stream* serial = nullptr;
+    uint8_t response[9] = {};
+};
@@ -0,0 +1,42 @@
+#pragma once
+// Host stand-in for 256dpi/arduino-mqtt. Publishes go to stdout; the broker
+// is reachable while hal::broker_up is set.
+
+#include <WiFi.h>
+#include <atomic>
+
+namespace hal {
+    extern bool broker_up;
+    extern std::atomic<unsigned long> publishes;
+}
+
+class MQTTClient {
+  public:
+    explicit MQTTClient(int bufSize = 128) { }
+
+    void begin(const char* host, int port, Client& client) { host_ = host; port_ = port; }
+    bool connect(const char* clientId) {
+        connected_ = hal::broker_up && WiFi.status() == WL_CONNECTED;
+        return connected_;
+    }
+    bool connected() {
+        if (!hal::broker_up || WiFi.status() != WL_CONNECTED) connected_ = false;
+        return connected_;
+    }
+    bool publish(const String& topic, const String& payload, bool retained, int qos) {
+        return publish(topic.c_str(), payload.c_str(), payload.length(), retained, qos);
+    }
+    bool publish(const char topic[], const char payload[], int length, bool retained, int qos) {
+        if (!connected()) return false;
+        hal::publishes++;
+        printf("[mqtt %s:%d] %s %.*s\n", host_.c_str(), port_, topic, length, payload);
+        return true;
+    }
+    bool loop() { return connected(); }
+    bool disconnect() { connected_ = false; return true; }
+
+  private:
+    String host_;
+    int port_ = 0;
+    bool connected_ = false;
+};
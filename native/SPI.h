@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in: the display stand-in does not use a bus.
+
+#include <Arduino.h>
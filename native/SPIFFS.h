@@ -0,0 +1,66 @@
+#pragma once
+// Host stand-in for the ESP32 SPIFFS filesystem, backed by a directory
+// (OPERAME_SPIFFS, default /tmp/operame-spiffs). Paths are flat, like SPIFFS.
+
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+class File : public Stream {
+  public:
+    File() { }
+    explicit File(FILE* f) : f_(f, fclose) { }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override { return f_ ? fwrite(buf, 1, size, f_.get()) : 0; }
+    int available() override { return f_ ? size() - position() : 0; }
+    int read() override { return f_ ? fgetc(f_.get()) : -1; }
+    size_t read(uint8_t* buf, size_t size) { return f_ ? fread(buf, 1, size, f_.get()) : 0; }
+    int peek() override {
+        if (!f_) return -1;
+        int c = fgetc(f_.get());
+        if (c >= 0) ungetc(c, f_.get());
+        return c;
+    }
+    void flush() override { if (f_) fflush(f_.get()); }
+    bool seek(uint32_t pos) { return f_ && fseek(f_.get(), pos, SEEK_SET) == 0; }
+    size_t position() const { return f_ ? ftell(f_.get()) : 0; }
+    size_t size() const {
+        if (!f_) return 0;
+        long pos = ftell(f_.get());
+        fseek(f_.get(), 0, SEEK_END);
+        long size = ftell(f_.get());
+        fseek(f_.get(), pos, SEEK_SET);
+        return size;
+    }
+    void close() { f_.reset(); }
+    explicit operator bool() const { return (bool) f_; }
+
+  private:
+    std::shared_ptr<FILE> f_;
+};
+
+class SPIFFSFS {
+  public:
+    bool begin(bool formatOnFail = false);
+    bool format();
+    File open(const char* path, const char* mode = FILE_READ);
+    File open(const String& path, const char* mode = FILE_READ) { return open(path.c_str(), mode); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+    size_t totalBytes() { return 0x170000; }
+    size_t usedBytes();
+
+  private:
+    std::string real(const char* path);
+    std::string root;
+};
+
+extern SPIFFSFS SPIFFS;
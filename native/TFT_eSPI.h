@@ -0,0 +1,275 @@
+#pragma once
+// Host stand-in for TFT_eSPI. Sprites are real RGB565 framebuffers so drawing
+// costs roughly what it does on the device; pushes to the panel are counted
+// instead of clocked out over SPI.
+
+#include <Arduino.h>
+#include <vector>
+#include <atomic>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH  135
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 240
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_BLUE        0x001F
+#define TFT_RED         0xF800
+#define TFT_GREEN       0x07E0
+#define TFT_YELLOW      0xFFE0
+#define TFT_MAGENTA     0xF81F
+#define TFT_WHITE       0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+namespace hal {
+    // Panel traffic since boot, in pixels and push calls.
+    extern std::atomic<unsigned long long> pixels_pushed;
+    extern std::atomic<unsigned long> pushes;
+    // Framebuffer memory of the most recently created sprite
+    extern size_t sprite_bytes;
+}
+
+class TFT_eSPI {
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) : _init_width(w), _init_height(h) {
+        _width = w;
+        _height = h;
+    }
+    virtual ~TFT_eSPI() { }
+
+    void init() { }
+    void startWrite() { }
+    void endWrite() { }
+    void setRotation(uint8_t r) {
+        rotation = r & 3;
+        _width  = rotation & 1 ? _init_height : _init_width;
+        _height = rotation & 1 ? _init_width  : _init_height;
+    }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    virtual void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { }
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color) { }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        fillRect(x, y, w, 1, color);
+        fillRect(x, y + h - 1, w, 1, color);
+        fillRect(x, y, 1, h, color);
+        fillRect(x + w - 1, y, 1, h, color);
+    }
+
+    void setTextSize(uint8_t s) { textsize = s ? s : 1; }
+    void setTextFont(uint8_t f) { textfont = f; }
+    void setTextDatum(uint8_t d) { textdatum = d; }
+    void setTextColor(uint16_t fg, uint16_t bg) { textcolor = fg; textbgcolor = bg; }
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+
+    int16_t fontHeight() const { return font_height(textfont) * textsize; }
+    int16_t textWidth(const String& s) const { return textWidth(s.c_str()); }
+    int16_t textWidth(const char* s) const {
+        int16_t w = 0;
+        while (*s) w += glyph_width(textfont, *s++) * textsize;
+        return w;
+    }
+
+    // Glyphs are a background cell with a filled foreground box; the shape
+    // differs from the real fonts but the metrics match. They are drawn the
+    // way TFT_eSprite::drawChar() draws the run-length encoded fonts: with a
+    // background colour pixel by pixel, one drawPixel() per pixel of the
+    // cell, and without one as a line per foreground run.
+    int16_t drawString(const String& s, int32_t x, int32_t y) { return drawString(s.c_str(), x, y); }
+    int16_t drawString(const char* s, int32_t x, int32_t y) {
+        int16_t w = textWidth(s), h = fontHeight();
+        x -= (textdatum % 3) * w / 2;
+        y -= (textdatum / 3) * h / 2;
+        for (; *s; s++) {
+            int16_t gw = glyph_width(textfont, *s) * textsize;
+            drawGlyph(x, y, gw, h, *s != ' ');
+            x += gw;
+        }
+        return w;
+    }
+    // DMA: a transfer keeps the bus busy for as long as it would take at
+    // 40 MHz, in the background; pixels are counted, not drawn.
+    bool initDMA(bool ctrl_cs = false) { return true; }
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr) {
+        dmaWait();
+        hal::pixels_pushed += (unsigned long long) w * h;
+        hal::pushes++;
+        _dma_done = micros() + (unsigned long) w * h * 16 / 40;
+    }
+    bool dmaBusy() { return (long) (_dma_done - micros()) > 0; }
+    void dmaWait() {
+        long left = _dma_done - micros();
+        if (left > 0) delayMicroseconds(left);
+    }
+
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+        for (int32_t j = 0; j < h; j++) for (int32_t i = 0; i < w; i++) {
+            uint16_t c = data[j * w + i];
+            drawPixel(x + i, y + j, _swapBytes ? (c >> 8 | c << 8) & 0xffff : c);
+        }
+    }
+
+    static int16_t font_height(uint8_t font) {
+        switch (font) {
+            case 2: return 16;
+            case 4: return 26;
+            case 6: return 48;
+            case 7: return 48;
+            case 8: return 75;
+            default: return 8;
+        }
+    }
+    static int16_t glyph_width(uint8_t font, char c) {
+        switch (font) {
+            case 2: return 8;
+            case 4: return c == ' ' ? 7 : 14;
+            case 6: return 27;
+            case 7: return 32;
+            case 8: return c >= '0' && c <= '9' ? 55 : 27;
+            default: return 6;
+        }
+    }
+
+    uint8_t rotation = 0;
+    uint8_t textsize = 1, textfont = 1, textdatum = TL_DATUM;
+    uint16_t textcolor = TFT_WHITE, textbgcolor = TFT_BLACK;
+
+  protected:
+    void drawGlyph(int32_t x, int32_t y, int16_t w, int16_t h, bool ink) {
+        int16_t left = w / 8, right = left + w - w / 4;
+        int16_t top = h / 8, bottom = top + h - h / 4;
+        for (int16_t j = 0; j < h; j++) {
+            bool inked = ink && j >= top && j < bottom;
+            if (textcolor == textbgcolor) {
+                if (inked) drawFastHLine(x + left, y + j, right - left, textcolor);
+                continue;
+            }
+            for (int16_t i = 0; i < w; i++) {
+                drawPixel(x + i, y + j, inked && i >= left && i < right ? textcolor : textbgcolor);
+            }
+        }
+    }
+
+    int16_t _init_width, _init_height, _width, _height;
+    bool _swapBytes = false;
+    unsigned long _dma_done = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+  public:
+    explicit TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), _tft(tft) { }
+
+    // Like the real library, the depth must be set before createSprite();
+    // at 4 bits per pixel colours are palette indexes, expanded when pushed.
+    void setColorDepth(int8_t depth) { _depth = depth; }
+    int8_t getColorDepth() const { return _depth; }
+    void createPalette(const uint16_t* colors, uint8_t count = 16) {
+        for (int i = 0; i < count && i < 16; i++) _palette[i] = colors[i];
+    }
+
+    // Same memory layout as the real library: RGB565 words, or at 4 bpp two
+    // pixels per byte with the even x in the high nibble.
+    void* createSprite(int16_t w, int16_t h) {
+        _width = w;
+        _height = h;
+        if (_depth != 4) _depth = 16;
+        _stride = _depth == 4 ? (w + 1) / 2 : w * 2;
+        _buf.assign((size_t) _stride * h, 0);
+        hal::sprite_bytes = _buf.size();
+        return _buf.data();
+    }
+    void* getPointer() { return _buf.data(); }
+    void deleteSprite() { _buf.clear(); _width = _height = 0; }
+    void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override {
+        int32_t x1 = std::max<int32_t>(x, 0), x2 = std::min<int32_t>(x + w, _width);
+        int32_t y1 = std::max<int32_t>(y, 0), y2 = std::min<int32_t>(y + h, _height);
+        if (x1 >= x2) return;
+        for (int32_t j = y1; j < y2; j++) {
+            if (_depth == 16) {
+                uint16_t* row = (uint16_t*) &_buf[j * _stride];
+                std::fill(row + x1, row + x2, (uint16_t) color);
+                continue;
+            }
+            int32_t i = x1;
+            if (i & 1) set(i++, j, color);
+            uint8_t c = color & 0x0f;
+            memset(&_buf[j * _stride + i / 2], c << 4 | c, (x2 - i) / 2);
+            if (x2 & 1 && x2 - 1 >= i) set(x2 - 1, j, color);
+        }
+    }
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override {
+        if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+        set(x, y, color);
+    }
+    // Palette index at 4 bpp, like readPixelValue() of the real library
+    uint16_t readPixel(int32_t x, int32_t y) const {
+        if (_depth == 16) return ((const uint16_t*) &_buf[y * _stride])[x];
+        uint8_t b = _buf[y * _stride + x / 2];
+        return x & 1 ? b & 0x0f : b >> 4;
+    }
+
+    // Moves the pixels of the scroll rectangle by dx, dy and fills what is
+    // uncovered with its colour. The real library takes a fast path at 4 bpp
+    // only for even dx, x and w; this one is slow for any.
+    void setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color = TFT_BLACK) {
+        _sx = std::max<int32_t>(x, 0);
+        _sy = std::max<int32_t>(y, 0);
+        _sw = std::min<int32_t>(x + w, _width) - _sx;
+        _sh = std::min<int32_t>(y + h, _height) - _sy;
+        _scolor = color;
+    }
+    void scroll(int16_t dx, int16_t dy = 0) {
+        if (_sw <= 0 || _sh <= 0) return;
+        std::vector<uint16_t> copy((size_t) _sw * _sh);
+        for (int32_t j = 0; j < _sh; j++) for (int32_t i = 0; i < _sw; i++) {
+            copy[j * _sw + i] = readPixel(_sx + i, _sy + j);
+        }
+        for (int32_t j = 0; j < _sh; j++) for (int32_t i = 0; i < _sw; i++) {
+            int32_t fi = i - dx, fj = j - dy;
+            bool inside = fi >= 0 && fi < _sw && fj >= 0 && fj < _sh;
+            set(_sx + i, _sy + j, inside ? copy[fj * _sw + fi] : _scolor);
+        }
+    }
+
+    void pushSprite(int32_t x, int32_t y) { pushSprite(x, y, 0, 0, _width, _height); }
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+        if (sw <= 0 || sh <= 0) return false;
+        hal::pixels_pushed += (unsigned long long) sw * sh;
+        hal::pushes++;
+        return true;
+    }
+
+  private:
+    void set(int32_t x, int32_t y, uint32_t color) {
+        if (_depth == 16) {
+            ((uint16_t*) &_buf[y * _stride])[x] = color;
+            return;
+        }
+        uint8_t& b = _buf[y * _stride + x / 2];
+        b = x & 1 ? (b & 0xf0) | (color & 0x0f) : (b & 0x0f) | (color & 0x0f) << 4;
+    }
+
+    TFT_eSPI* _tft;
+    int8_t _depth = 16;
+    int32_t _stride = 0;
+    uint16_t _palette[16] = {};
+    std::vector<uint8_t> _buf;
+    int32_t _sx = 0, _sy = 0, _sw = 0, _sh = 0;
+    uint16_t _scolor = 0;
+};
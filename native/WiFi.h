@@ -0,0 +1,148 @@
+#pragma once
+// Host stand-in for the ESP32 WiFi library. Association succeeds while
+// hal::wifi_up is set.
+
+#include <Arduino.h>
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace hal {
+    extern bool wifi_up;
+}
+
+typedef enum {
+    WL_IDLE_STATUS      = 0,
+    WL_NO_SSID_AVAIL    = 1,
+    WL_CONNECTED        = 3,
+    WL_CONNECT_FAILED   = 4,
+    WL_CONNECTION_LOST  = 5,
+    WL_DISCONNECTED     = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+class IPAddress {
+  public:
+    IPAddress(uint32_t address = 0) : address(address) { }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t) d << 24) { }
+    operator uint32_t() const { return address; }
+
+  private:
+    uint32_t address;
+};
+
+// There is one access point, "operame" on channel 6. Association takes
+// roughly what it does on the ESP32: 2 s to scan all channels unless the
+// access point and channel are given, then 1 s for DHCP unless the address
+// is configured.
+class WiFiClass {
+  public:
+    wl_status_t status() {
+        return connected && (long) (millis() - ready_at) >= 0 ? WL_CONNECTED : WL_DISCONNECTED;
+    }
+    uint8_t softAPgetStationNum() { return 0; }
+    String macAddress() { return "24:0A:C4:00:00:00"; }
+
+    bool mode(wifi_mode_t m) { return true; }
+    bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns = (uint32_t) 0) {
+        static_ip = ip;
+        return true;
+    }
+    wl_status_t begin(const char* ssid, const char* password = nullptr, int32_t channel = 0, const uint8_t* bssid = nullptr, bool connect = true) {
+        bool directed = channel && bssid;
+        connected = hal::wifi_up && !strcmp(ssid, "operame")
+            && (!directed || (channel == 6 && !memcmp(bssid, ap, sizeof(ap))));
+        ready_at = millis() + (directed ? 300 : 2000) + (static_ip ? 0 : 1000);
+        return status();
+    }
+    bool disconnect(bool wifioff = false, bool eraseap = false) { connected = false; return true; }
+
+    String SSID() { return connected ? "operame" : ""; }
+    uint8_t* BSSID() { return ap; }
+    int32_t channel() { return 6; }
+    IPAddress localIP() { return static_ip ? IPAddress(static_ip) : IPAddress(10, 0, 0, 42); }
+    IPAddress gatewayIP() { return IPAddress(10, 0, 0, 1); }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress dnsIP(uint8_t n = 0) { return IPAddress(10, 0, 0, 1); }
+
+    bool connected = false;
+
+  private:
+    uint8_t ap[6] = { 0x24, 0x0a, 0xc4, 0x11, 0x22, 0x33 };
+    uint32_t static_ip = 0;
+    unsigned long ready_at = 0;
+};
+
+extern WiFiClass WiFi;
+
+class Client : public Stream { };
+
+namespace hal {
+    // A TCP connection to a WiFiServer, made by hal::http_get(): what the
+    // peer sent and has yet to be read, and what it got back.
+    struct Connection {
+        std::string     request;
+        size_t          position = 0;
+        std::string     response;
+        size_t          received = 0;
+        unsigned long   opened = 0;     // ms
+        bool            closed = false;
+    };
+    void closed(Connection& connection);
+}
+
+// Without a connection, as for MQTT, writes go nowhere and nothing arrives
+class WiFiClient : public Client {
+  public:
+    WiFiClient() { }
+    explicit WiFiClient(std::shared_ptr<hal::Connection> c) : c(c) { }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override {
+        if (!connected()) return c ? 0 : size;
+        c->response.append((const char*) buf, size);
+        c->received += size;
+        return size;
+    }
+    int available() override { return connected() ? c->request.size() - c->position : 0; }
+    int read() override { return available() ? (uint8_t) c->request[c->position++] : -1; }
+    int peek() override { return available() ? (uint8_t) c->request[c->position] : -1; }
+
+    uint8_t connected() { return c && !c->closed; }
+    operator bool() { return connected(); }
+    void stop() {
+        if (!connected()) return;
+        c->closed = true;
+        hal::closed(*c);
+    }
+
+  private:
+    std::shared_ptr<hal::Connection> c;
+};
+
+namespace hal {
+    // Connections waiting to be accepted, per port
+    std::deque<std::shared_ptr<Connection>>& backlog(uint16_t port);
+}
+
+class WiFiServer {
+  public:
+    explicit WiFiServer(uint16_t port = 80) : port(port) { }
+    void begin() { listening = true; }
+    void setNoDelay(bool nodelay) { }
+
+    // Never waits: an invalid client if no connection is pending
+    WiFiClient available() {
+        auto& pending = hal::backlog(port);
+        if (!listening || pending.empty()) return WiFiClient();
+        auto c = pending.front();
+        pending.pop_front();
+        return WiFiClient(c);
+    }
+
+  private:
+    uint16_t    port;
+    bool        listening = false;
+};
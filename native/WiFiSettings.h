@@ -0,0 +1,68 @@
+#pragma once
+// Host stand-in for ESP-WiFiSettings. Instead of files in SPIFFS, each setting
+// is read from the environment variable of the same name (e.g.
+// operame_mqtt=1 mqtt_server=localhost), falling back to its default.
+
+#include <WiFi.h>
+
+class WiFiSettingsClass {
+  public:
+    typedef std::function<void(void)> TCallback;
+    typedef std::function<int(void)> TCallbackInt;
+
+    void begin() { hostname += "000000"; }
+
+    String string(const String& name, const String& init = "", const String& label = "") {
+        const char* v = getenv(name.c_str());
+        return v ? String(v) : init;
+    }
+    String string(const String& name, unsigned int max_length, const String& init = "", const String& label = "") {
+        return string(name, init, label).substring(0, max_length);
+    }
+    long integer(const String& name, long init = 0, const String& label = "") {
+        const char* v = getenv(name.c_str());
+        return v ? strtol(v, nullptr, 10) : init;
+    }
+    long integer(const String& name, long min, long max, long init = 0, const String& label = "") {
+        long v = integer(name, init, label);
+        return v < min || v > max ? init : v;
+    }
+    bool checkbox(const String& name, bool init = false, const String& label = "") {
+        const char* v = getenv(name.c_str());
+        return v ? strcmp(v, "0") != 0 : init;
+    }
+    void heading(const String& contents, bool escape = true) { }
+    void info(const String& contents, bool escape = true) { }
+    void warning(const String& contents, bool escape = true) { }
+
+    bool connect(bool portal = true, int wait_seconds = 30) {
+        WiFi.mode(WIFI_STA);
+        WiFi.begin("operame");
+        unsigned long start = millis();
+        while (WiFi.status() != WL_CONNECTED && millis() - start < wait_seconds * 1000UL) {
+            delay(onConnect ? onConnect() : 100);
+        }
+        if (WiFi.status() == WL_CONNECTED) {
+            if (onSuccess) onSuccess();
+            return true;
+        }
+        if (onFailure) onFailure();
+        if (portal) this->portal();
+        return false;
+    }
+    [[noreturn]] void portal() {
+        if (onPortal) onPortal();
+        for (;;) {
+            if (onPortalWaitLoop) onPortalWaitLoop();
+            delay(100);
+        }
+    }
+
+    String hostname;
+    String password;
+    String language;
+    TCallbackInt onConnect;
+    TCallback onSuccess, onFailure, onPortal, onPortalView, onConfigSaved, onPortalWaitLoop;
+};
+
+extern WiFiSettingsClass WiFiSettings;
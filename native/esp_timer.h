@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in for the ESP-IDF high resolution timer.
+
+#include <Arduino.h>
+
+int64_t esp_timer_get_time();
@@ -0,0 +1,286 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <MQTT.h>
+#include <SPIFFS.h>
+#include <esp_timer.h>
+#include <WiFiSettings.h>
+#include <ArduinoOTA.h>
+#include <TFT_eSPI.h>
+#include "hal.h"
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <map>
+#include <vector>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+HardwareSerial      Serial(0);
+EspClass            ESP;
+WiFiClass           WiFi;
+SPIFFSFS            SPIFFS;
+WiFiSettingsClass   WiFiSettings;
+ArduinoOTAClass     ArduinoOTA;
+
+namespace hal {
+    bool simulated = false;
+    int pin_level[40];
+    std::atomic<unsigned long long> pixels_pushed;
+    size_t sprite_bytes;
+    std::atomic<unsigned long> pushes;
+    bool wifi_up = true;
+    bool broker_up = true;
+    std::atomic<unsigned long> publishes;
+}
+
+// Simulation: every task is still a thread, but only one runs at a time. A
+// task gives up its turn in delay(); the clock then jumps to the earliest
+// wake-up time of all tasks, after running the scripted events due by then.
+// Ties go to the task that was started first, so runs are reproducible.
+static std::mutex               sim_mutex;
+static std::condition_variable  sim_turn;
+static uint64_t                 sim_now;        // us
+static std::vector<uint64_t>    sim_wake;       // per task, 0 is setup()/loop()
+static size_t                   sim_running;
+static thread_local size_t      sim_task;
+static std::multimap<uint64_t, std::function<void()>> sim_events;
+static double                   sim_cpu_factor; // see hal::charge_cpu()
+static thread_local uint64_t    sim_cpu_at;     // CPU time of this thread at its turn, ns
+
+static uint64_t thread_cpu_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void hal::simulate() {
+    simulated = true;
+    sim_wake.assign(1, 0);
+    sim_cpu_at = thread_cpu_ns();
+}
+
+void hal::charge_cpu(double factor) {
+    std::lock_guard<std::mutex> lock(sim_mutex);
+    sim_cpu_factor = factor;
+}
+
+void hal::at(unsigned long ms, std::function<void()> fn) {
+    std::lock_guard<std::mutex> lock(sim_mutex);
+    sim_events.emplace((uint64_t) ms * 1000, fn);
+}
+
+static void sim_sleep(uint64_t us) {
+    uint64_t cpu = thread_cpu_ns();
+    std::unique_lock<std::mutex> lock(sim_mutex);
+    size_t self = sim_task;
+    sim_now += (uint64_t) ((cpu - sim_cpu_at) * sim_cpu_factor / 1000);
+    sim_wake[self] = sim_now + us;
+    for (;;) {
+        size_t next = 0;
+        for (size_t i = 1; i < sim_wake.size(); i++) {
+            if (sim_wake[i] < sim_wake[next]) next = i;
+        }
+
+        auto event = sim_events.begin();
+        if (event != sim_events.end() && event->first <= sim_wake[next]) {
+            sim_now = std::max(sim_now, event->first);
+            auto fn = event->second;
+            sim_events.erase(event);
+            lock.unlock();
+            fn();
+            lock.lock();
+            continue;
+        }
+
+        sim_now = std::max(sim_now, sim_wake[next]);
+        if (next != self) {
+            sim_running = next;
+            sim_turn.notify_all();
+            sim_turn.wait(lock, [self] { return sim_running == self; });
+        }
+        sim_cpu_at = thread_cpu_ns();
+        return;
+    }
+}
+
+void hal::start_task(const char* name, void (*body)()) {
+    if (!simulated) {
+        std::thread([body] { for (;;) body(); }).detach();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(sim_mutex);
+    size_t id = sim_wake.size();
+    sim_wake.push_back(sim_now);
+    std::thread([id, body] {
+        sim_task = id;
+        {
+            std::unique_lock<std::mutex> lock(sim_mutex);
+            sim_turn.wait(lock, [id] { return sim_running == id; });
+        }
+        sim_cpu_at = thread_cpu_ns();
+        for (;;) body();
+    }).detach();
+}
+
+unsigned long micros() {
+    if (hal::simulated) return sim_now;
+
+    // Function-local so that it is set before firmware globals use it
+    static const auto boot = std::chrono::steady_clock::now();
+    auto t = std::chrono::steady_clock::now() - boot;
+    return std::chrono::duration_cast<std::chrono::microseconds>(t).count();
+}
+
+int64_t esp_timer_get_time() {
+    if (hal::simulated) return sim_now;
+    return micros();
+}
+
+unsigned long millis() {
+    return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+    if (hal::simulated) return sim_sleep((uint64_t) ms * 1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    if (hal::simulated) return sim_sleep(us);
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// Busy-waits call this; in a simulation time has to pass for them to end
+void yield() {
+    if (hal::simulated) return sim_sleep(100);
+    std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode) { }
+
+int digitalRead(uint8_t pin) {
+    return pin < 40 ? hal::pin_level[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) { }
+
+static struct {
+    void (*handler)(void*);
+    void* arg;
+    int mode;
+} interrupts[40];
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    if (pin < 40) interrupts[pin] = { handler, arg, mode };
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin < 40) interrupts[pin] = { };
+}
+
+void hal::set_pin(uint8_t pin, int level) {
+    if (pin >= 40 || pin_level[pin] == level) return;
+    pin_level[pin] = level;
+
+    auto& i = interrupts[pin];
+    int edge = level == HIGH ? RISING : FALLING;
+    if (i.handler && (i.mode & edge)) i.handler(i.arg);
+}
+
+void EspClass::restart() {
+    fflush(stdout);
+    printf("ESP.restart()\n");
+    fflush(stdout);
+    _exit(3);
+}
+
+uint32_t EspClass::getFreeHeap() {
+    return 0;
+}
+
+uint32_t EspClass::getCycleCount() {
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t).count() * 240 / 1000;
+}
+
+bool SPIFFSFS::begin(bool formatOnFail) {
+    const char* dir = getenv("OPERAME_SPIFFS");
+    root = dir ? dir : "/tmp/operame-spiffs";
+    mkdir(root.c_str(), 0755);
+    struct stat st;
+    return stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool SPIFFSFS::format() {
+    DIR* d = opendir(root.c_str());
+    if (!d) return false;
+    while (auto e = readdir(d)) {
+        if (e->d_name[0] != '.') unlink((root + "/" + e->d_name).c_str());
+    }
+    closedir(d);
+    return true;
+}
+
+std::string SPIFFSFS::real(const char* path) {
+    std::string p = path;
+    std::replace(p.begin() + 1, p.end(), '/', '%');  // flat, like SPIFFS
+    return root + p;
+}
+
+File SPIFFSFS::open(const char* path, const char* mode) {
+    std::string m = mode;
+    if (m == "r") m = "rb";
+    else if (m == "w") m = "w+b";
+    else if (m == "a") m = "a+b";
+    FILE* f = fopen(real(path).c_str(), m.c_str());
+    return f ? File(f) : File();
+}
+
+bool SPIFFSFS::exists(const char* path) {
+    struct stat st;
+    return stat(real(path).c_str(), &st) == 0;
+}
+
+bool SPIFFSFS::remove(const char* path) {
+    return unlink(real(path).c_str()) == 0;
+}
+
+bool SPIFFSFS::rename(const char* from, const char* to) {
+    return ::rename(real(from).c_str(), real(to).c_str()) == 0;
+}
+
+size_t SPIFFSFS::usedBytes() {
+    size_t used = 0;
+    DIR* d = opendir(root.c_str());
+    if (!d) return 0;
+    while (auto e = readdir(d)) {
+        struct stat st;
+        if (e->d_name[0] != '.' && stat((root + "/" + e->d_name).c_str(), &st) == 0) used += st.st_size;
+    }
+    closedir(d);
+    return used;
+}
+
+static std::map<uint16_t, std::deque<std::shared_ptr<hal::Connection>>> backlogs;
+hal::HTTPStats hal::http;
+
+std::deque<std::shared_ptr<hal::Connection>>& hal::backlog(uint16_t port) {
+    return backlogs[port];
+}
+
+void hal::http_get(uint16_t port, const char* path) {
+    auto c = std::make_shared<Connection>();
+    c->request = std::string("GET ") + path + " HTTP/1.1\r\nHost: operame\r\nUser-Agent: load\r\n\r\n";
+    c->opened = millis();
+    backlogs[port].push_back(c);
+    http.requests++;
+}
+
+void hal::closed(Connection& c) {
+    if (c.response.compare(0, 12, "HTTP/1.0 200") == 0) http.ok++;
+    http.bytes += c.received;
+    http.latency_max = std::max(http.latency_max, millis() - c.opened);
+}
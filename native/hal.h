@@ -0,0 +1,49 @@
+#pragma once
+// Hooks into the host stand-ins, for use by the host runner only.
+
+#include <Arduino.h>
+#include <functional>
+
+namespace hal {
+    // Emulates a CO2 sensor on the far end of `serial`. Kind is "mhz" (MH-Z19
+    // with firmware 0436), "aqc" or "none".
+    void attach_sensor(HardwareSerial& serial, const char* kind);
+
+    // PPM value the emulated sensor reports at a given time.
+    int co2_at(unsigned long ms);
+
+    // A fixed value to report instead, or 0 for co2_at().
+    extern int co2_override;
+
+    // Answers as the device did in a trace from OperameCapture: each command
+    // gets the responses that followed it there, after the same delays.
+    // Commands not in the trace go unanswered. Calls `done` at the first
+    // command after the end of the trace.
+    void replay_sensor(HardwareSerial& serial, const char* path, std::function<void()> done);
+
+    // Connects to a WiFiServer on `port` and sends a GET request for `path`
+    void http_get(uint16_t port, const char* path);
+
+    // Of the connections made by http_get()
+    struct HTTPStats {
+        unsigned long   requests = 0;
+        unsigned long   ok = 0;             // answered with 200
+        unsigned long   bytes = 0;          // received
+        unsigned long   latency_max = 0;    // ms from connecting until closed
+    };
+    extern HTTPStats http;
+
+    // Switches to the virtual clock; call before anything reads the time.
+    void simulate();
+
+    // In a simulation, lets the host CPU time of each task pass on the
+    // virtual clock too, times `factor`, as if all tasks shared a single
+    // core that much slower than the host. Work that takes long then makes
+    // other jobs late, as it would on the device; runs are no longer exactly
+    // reproducible, though. 0, the default, charges nothing.
+    void charge_cpu(double factor);
+
+    // Calls `fn` once the virtual clock reaches `ms`, on whichever task is
+    // running then.
+    void at(unsigned long ms, std::function<void()> fn);
+}
@@ -0,0 +1,151 @@
+// Host runner: boots the firmware against the stand-ins in this directory.
+//
+// Environment:
+//   OPERAME_SENSOR=mhz|aqc|none   emulated sensor (default mhz)
+//   OPERAME_REPLAY=file           instead, a sensor answering as in a trace
+//                                 recorded with operame_capture; stops at its end
+//   OPERAME_WIFI=down             association fails
+//   OPERAME_BROKER=down           MQTT broker unreachable
+//   OPERAME_RUN_SECONDS=n         stop after n seconds and print statistics
+//   OPERAME_SIMULATE=hours        run on a virtual clock for this many hours,
+//                                 as fast as the host can, then print statistics
+//   OPERAME_SCRIPT=file           events for a simulation, one per line:
+//                                   <seconds> co2 <ppm>|auto
+//                                   <seconds> broker up|down
+//                                   <seconds> wifi up|down
+//                                   <seconds> press <pin> <ms>
+//   OPERAME_HTTP_LOAD=n           in a simulation, n requests per second for
+//                                 /metrics and /history.json in turn
+//   OPERAME_CPU_FACTOR=n          in a simulation, charge host CPU time n times
+//                                 to the virtual clock (see hal::charge_cpu)
+// WiFiSettings values are taken from same-named variables, e.g. operame_mqtt=1.
+//
+// A simulation is deterministic: the same settings and script give the same
+// "summary:" line, so a change in renders or publishes shows up in a diff.
+// test/test_simulation runs a short one and checks the counts against bounds.
+// An hour takes about ten seconds on one core.
+
+#include "hal.h"
+#include <TFT_eSPI.h>
+#include <WiFi.h>
+#include <MQTT.h>
+#include <unistd.h>
+
+void setup();
+void loop();
+void print_report(Print& out);
+extern HardwareSerial hwserial1;
+
+static bool is(const char* name, const char* value) {
+    const char* v = getenv(name);
+    return v && !strcmp(v, value);
+}
+
+static void statistics(unsigned long iterations) {
+    unsigned long elapsed = millis();
+    printf("loop: %lu iterations in %lu ms (%.1f us each)\n",
+        iterations, elapsed, iterations ? elapsed * 1000.0 / iterations : 0.0);
+    printf("display: %lu pushes, %llu pixels, %zu byte framebuffer\n", hal::pushes.load(), hal::pixels_pushed.load(), hal::sprite_bytes);
+    printf("mqtt: %lu publishes\n", hal::publishes.load());
+    if (hal::http.requests) {
+        printf("http: %lu requests, %lu answered with 200, %lu bytes, slowest %lu ms\n",
+            hal::http.requests, hal::http.ok, hal::http.bytes, hal::http.latency_max);
+    }
+    print_report(Serial);
+
+    // Only counts; the run times above are measured on the host
+    printf("summary: loops=%lu pushes=%lu pixels=%llu publishes=%lu\n",
+        iterations, hal::pushes.load(), hal::pixels_pushed.load(), hal::publishes.load());
+    // The firmware's tasks never end; leave without running destructors
+    fflush(stdout);
+    _exit(0);
+}
+
+// Requests every `period` ms from `start` on, alternating between the pages
+static void load(unsigned long start, unsigned long period) {
+    hal::at(start, [start, period] {
+        static unsigned long n = 0;
+        hal::http_get(80, n++ % 2 ? "/history.json" : "/metrics");
+        load(start + period, period);
+    });
+}
+
+static void load_script(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+
+    char line[128];
+    int number = 0;
+    while (fgets(line, sizeof(line), f)) {
+        number++;
+        double seconds;
+        char what[16] = "", arg[16] = "";
+        int ms = 0;
+        int n = sscanf(line, "%lf %15s %15s %d", &seconds, what, arg, &ms);
+        if (n <= 0 || line[0] == '#') continue;
+
+        unsigned long t = seconds * 1000;
+        std::string value = arg;
+        if (!strcmp(what, "co2")) {
+            int ppm = value == "auto" ? 0 : atoi(arg);
+            hal::at(t, [ppm] { hal::co2_override = ppm; });
+        } else if (!strcmp(what, "broker")) {
+            bool up = value == "up";
+            hal::at(t, [up] { hal::broker_up = up; });
+        } else if (!strcmp(what, "wifi")) {
+            bool up = value == "up";
+            hal::at(t, [up] { hal::wifi_up = WiFi.connected = up; });
+        } else if (!strcmp(what, "press") && n == 4) {
+            int pin = atoi(arg);
+            hal::at(t, [pin] { hal::set_pin(pin, LOW); });
+            hal::at(t + ms, [pin] { hal::set_pin(pin, HIGH); });
+        } else {
+            fprintf(stderr, "%s:%d: not understood: %s", path, number, line);
+            exit(1);
+        }
+    }
+    fclose(f);
+}
+
+// The tests in test/ link the firmware too, and bring their own main()
+#ifndef PIO_UNIT_TESTING
+int main() {
+    const char* simulate = getenv("OPERAME_SIMULATE");
+    if (simulate) hal::simulate();
+
+    for (auto& level : hal::pin_level) level = HIGH;  // pull-ups, buttons released
+    hal::pin_level[12] = LOW;                          // pin_pcb_ok
+
+    static unsigned long iterations = 0;
+    const char* sensor = getenv("OPERAME_SENSOR");
+    if (const char* trace = getenv("OPERAME_REPLAY")) {
+        hal::replay_sensor(hwserial1, trace, [] { statistics(iterations); });
+    } else {
+        hal::attach_sensor(hwserial1, sensor ? sensor : "mhz");
+    }
+    hal::wifi_up = !is("OPERAME_WIFI", "down");
+    hal::broker_up = !is("OPERAME_BROKER", "down");
+
+    unsigned long limit = 0;
+    if (simulate) {
+        if (const char* script = getenv("OPERAME_SCRIPT")) load_script(script);
+        int rate = getenv("OPERAME_HTTP_LOAD") ? atoi(getenv("OPERAME_HTTP_LOAD")) : 0;
+        if (rate > 0) load(0, std::max(1000 / rate, 1));
+        if (const char* factor = getenv("OPERAME_CPU_FACTOR")) hal::charge_cpu(strtod(factor, nullptr));
+        hal::at(strtod(simulate, nullptr) * 3600 * 1000, [] { statistics(iterations); });
+    } else if (const char* run = getenv("OPERAME_RUN_SECONDS")) {
+        limit = strtoul(run, nullptr, 10) * 1000;
+    }
+
+    setup();
+    unsigned long start = millis();
+    while (!limit || millis() - start < limit) {
+        loop();
+        iterations++;
+    }
+    statistics(iterations);
+}
+#endif
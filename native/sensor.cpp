@@ -0,0 +1,121 @@
+#include "hal.h"
+#include <memory>
+#include <vector>
+
+// Warm-up period during which the sensors report their magic init values.
+static const unsigned long warmup = 30 * 1000;
+
+int hal::co2_override = 0;
+
+int hal::co2_at(unsigned long ms) {
+    // A classroom: slow daily swing plus a faster occupancy cycle.
+    double t = ms / 1000.0;
+    return 450 + (int) (250 * (1 + sin(t / 3600 * 2 * M_PI / 24))
+                      + 300 * (1 + sin(t / 2700 * 2 * M_PI)));
+}
+
+static uint8_t checksum(const uint8_t* frame) {
+    uint8_t sum = 0;
+    for (int i = 1; i < 8; i++) sum += frame[i];
+    return 0xff - sum + 1;
+}
+
+void hal::attach_sensor(HardwareSerial& serial, const char* kind) {
+    if (!strcmp(kind, "none")) return;
+    bool aqc = !strcmp(kind, "aqc");
+
+    auto rx = std::make_shared<std::string>();
+    serial.device = [&serial, aqc, rx](const uint8_t* buf, size_t size) {
+        rx->append((const char*) buf, size);
+        while (rx->size() >= 9) {
+            uint8_t cmd[9];
+            memcpy(cmd, rx->data(), 9);
+            rx->erase(0, 9);
+            if (cmd[0] != 0xff || cmd[8] != checksum(cmd)) continue;
+
+            unsigned long now = millis();
+            int co2 = hal::co2_override ? hal::co2_override : hal::co2_at(now);
+            bool init = now < warmup;
+            uint8_t frame[9] = { 0xff, cmd[2], 0, 0, 0, 0, 0, 0, 0 };
+
+            if (aqc && cmd[2] == 0xc5) {
+                if (init) co2 = 400;
+                frame[1] = 0x86;
+                frame[2] = co2 >> 8;
+                frame[3] = co2;
+            } else if (!aqc && cmd[2] == 0x86) {
+                if (init) co2 = 436;
+                frame[2] = co2 >> 8;
+                frame[3] = co2;
+                frame[4] = 25 + 40;
+            } else if (!aqc && cmd[2] == 0x85) {
+                frame[4] = co2 >> 8;
+                frame[5] = co2;
+            } else if (!aqc && cmd[2] == 0xa0) {
+                memcpy(frame + 2, "0436", 4);
+            } else {
+                continue;  // commands without a response
+            }
+            frame[8] = checksum(frame);
+            serial.inject(frame, sizeof(frame), 10);
+        }
+    };
+}
+
+namespace {
+    struct Exchange {
+        std::string command;
+        std::vector<std::pair<unsigned long, std::string>> responses;  // delay, bytes
+    };
+
+    std::string unhex(const char* hex) {
+        std::string bytes;
+        for (; isxdigit(hex[0]) && isxdigit(hex[1]); hex += 2) {
+            char pair[3] = { hex[0], hex[1], 0 };
+            bytes += (char) strtoul(pair, nullptr, 16);
+        }
+        return bytes;
+    }
+}
+
+void hal::replay_sensor(HardwareSerial& serial, const char* path, std::function<void()> done) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+
+    // Other lines, as in a whole console log, are skipped
+    auto exchanges = std::make_shared<std::vector<Exchange>>();
+    unsigned long sent_at = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long ms;
+        char direction, hex[128];
+        if (sscanf(line, "uart %lu %c %127s", &ms, &direction, hex) != 3) continue;
+        if (direction == '>') {
+            exchanges->push_back({ unhex(hex), {} });
+            sent_at = ms;
+        } else if (direction == '<' && !exchanges->empty()) {
+            exchanges->back().responses.emplace_back(ms - sent_at, unhex(hex));
+        }
+    }
+    fclose(f);
+    printf("replay: %zu commands from %s\n", exchanges->size(), path);
+
+    // Commands are matched in order, looking a few ahead in case the firmware
+    // skipped some of those in the trace.
+    auto next = std::make_shared<size_t>(0);
+    serial.device = [&serial, exchanges, next, done](const uint8_t* buf, size_t size) {
+        if (*next == exchanges->size()) done();  // after the last responses were read
+
+        std::string command((const char*) buf, size);
+        for (size_t i = *next; i < exchanges->size() && i < *next + 16; i++) {
+            auto& e = (*exchanges)[i];
+            if (e.command != command) continue;
+            for (auto& r : e.responses) serial.inject((const uint8_t*) r.second.data(), r.second.size(), r.first);
+            *next = i + 1;
+            break;
+        }
+    };
+}
@@ -1,25 +1,76 @@
 #include <WiFi.h>
 #include <MQTT.h>
 #include <SPIFFS.h>
+#include <esp_timer.h>
 #include <WiFiSettings.h>
-#include <MHZ19.h>
 #include <ArduinoOTA.h>
 #include <SPI.h>
 #include <TFT_eSPI.h>
 #include <logo.h>
-#include <list>
+#include <mutex>
 #include <operame_strings.h>
+#include <operame_uart.h>
+#include <operame_capture.h>
+#include <operame_sensors.h>
+#include <operame_tasks.h>
+#include <operame_scheduler.h>
+#include <operame_buttons.h>
+#include <operame_history.h>
+#include <operame_outbox.h>
+#include <operame_template.h>
+#include <operame_glyphs.h>
+#include <operame_display.h>
+#include <operame_stats.h>
+#include <operame_wifi.h>
+#include <operame_power.h>
+#include <operame_rollup.h>
+#include <operame_http.h>
 
 #define LANGUAGE "nl"
-OperameLanguage::Texts T;
+const OperameLanguage::Texts* T;
 
-enum Driver { AQC, MHZ };
-Driver          driver;
-MQTTClient      mqtt;
+MQTTClient      mqtt(2048);
 HardwareSerial  hwserial1(1);
+OperameCapture::Recorder sensor_serial(hwserial1);  // what the drivers talk to
+File            capture_file;
 TFT_eSPI        display;
 TFT_eSprite     sprite(&display);
-MHZ19           mhz;
+OperameGlyphs::Atlas digits;
+OperameDisplay::Pusher pusher;
+OperameButtons::Buttons buttons;
+OperameHistory::Log history;
+RTC_NOINIT_ATTR OperameRollup::Rollups rollups;  // survives soft resets
+OperameOutbox::Outbox<1440> outbox;  // a day at the default interval
+OperameTemplate::Template message_template;
+OperameUART::Transaction uart(sensor_serial);
+OperameSensors::AQC aqc(uart, sensor_serial);
+OperameSensors::MHZ mhz(uart, sensor_serial);
+// Probed in this order; leave drivers out to build for fewer sensors
+OperameSensors::Chain<OperameSensors::AQC, OperameSensors::MHZ> sensor(aqc, mhz);
+std::mutex      display_mutex;
+
+// Shared between the sensor, UI and network tasks
+struct Reading {
+    int         co2;
+    uint32_t    uptime;     // seconds, when it was taken
+};
+OperameTasks::Latest<Reading> co2_reading;
+std::atomic<bool> zero_requested { false };
+std::atomic<bool> portal_active { false };
+
+// Milliseconds from boot to the first of each, for the report; 0 until then
+std::atomic<unsigned long> first_reading_at { 0 };
+std::atomic<unsigned long> first_publish_at { 0 };
+unsigned long   wifi_connected_at = 0;
+bool            wifi_fast = false;      // via the cached access point
+bool            sensor_cached = false;  // driver taken from the last boot, until it answers
+int             cached_failures = 0;    // of that driver, all in a row
+
+// Periodic work, one scheduler per task
+OperameScheduler::Scheduler ui_jobs, sensor_jobs, network_jobs;
+OperameScheduler::Job* sensor_poll_job;
+OperameScheduler::Job* render_job;
+OperameScheduler::Job* buttons_job;
 
 const int       pin_portalbutton = 35;
 const int       pin_demobutton   = 0;
@@ -27,7 +78,6 @@ const int       pin_backlight    = 4;
 const int       pin_sensor_rx    = 27;
 const int       pin_sensor_tx    = 26;
 const int       pin_pcb_ok       = 12;   // pulled to GND by PCB trace
-int             mhz_co2_init     = 410;  // magic value reported during init
 
 // Configuration via WiFiSettings
 unsigned long   mqtt_interval;
@@ -37,61 +87,199 @@ int             co2_critical;
 int             co2_blink;
 String          mqtt_topic;
 String          mqtt_template;
+String          mqtt_backlog_topic;
+String          mqtt_stats_topic;
 bool            add_units;
 bool            wifi_enabled;
+bool            wifi_reuse_ip;
+bool            power_save;
+bool            http_enabled;
+bool            graph_shown = false;  // trend screen instead of the number
+OperamePower::Mode power_mode = OperamePower::NONE;
+int64_t         napped_us = 0;          // in light sleep by nap()
 bool            mqtt_enabled;
 int             max_failures;
+int             mqtt_batch;
+int             mqtt_rate;
+bool            mqtt_stats;
 
-void retain(const String& topic, const String& message) {
-    Serial.printf("%s %s\n", topic.c_str(), message.c_str());
-    mqtt.publish(topic, message, true, 0);
+uint32_t uptime() {
+    // seconds, without the 49 day wraparound of millis()
+    return esp_timer_get_time() / 1000000;
+}
+
+bool retain(const String& topic, const char* message, size_t length) {
+    Serial.print(topic);
+    Serial.print(' ');
+    Serial.println(message);
+    return mqtt.publish(topic.c_str(), message, length, true, 0);
+}
+
+// What display_big() last put on the panel, to skip or shrink redraws
+struct {
+    String  text;
+    int     fg, bg;
+    int     font, size;
+    bool    border;
+    bool    valid = false;
+} shown;
+
+// What display_graph() last drew; invalid once anything else is drawn
+struct {
+    uint32_t    newest;     // start of the minute in the rightmost bar
+    int         co2;        // number above the graph
+    bool        valid = false;
+} graphed;
+
+// The sprite holds 4-bit indexes into this palette instead of RGB565 pixels,
+// a quarter of the RAM; the colours are looked up when it is pushed.
+const uint16_t palette[] = {
+    TFT_BLACK, TFT_WHITE, TFT_RED, TFT_GREEN, TFT_BLUE, TFT_YELLOW, TFT_MAGENTA
+};
+
+int ink(int color) {
+    for (size_t i = 0; i < sizeof(palette) / sizeof(*palette); i++) {
+        if (palette[i] == color) return i;
+    }
+    return 1;
 }
 
 void clear_sprite(int bg = TFT_BLACK) {
-    sprite.fillSprite(bg);
+    shown.valid = false;
+    graphed.valid = false;
+    sprite.fillSprite(ink(bg));
     if (WiFi.status() == WL_CONNECTED) {
-        sprite.drawRect(0, 0, display.width(), display.height(), TFT_BLUE);
+        sprite.drawRect(0, 0, display.width(), display.height(), ink(TFT_BLUE));
+    }
+}
+
+// Horizontal span of the glyphs that differ between two strings drawn
+// centered in the current font; the whole of both if the layout changed.
+void changed_span(const String& a, const String& b, int& x1, int& x2) {
+    int wa = sprite.textWidth(a), wb = sprite.textWidth(b);
+    int xa = display.width()/2 - wa/2, xb = display.width()/2 - wb/2;
+    x1 = std::min(xa, xb);
+    x2 = std::max(xa + wa, xb + wb);
+    if (a.length() != b.length() || wa != wb) return;
+
+    int x = xa, first = x2, last = x1;
+    for (unsigned int i = 0; i < a.length(); i++) {
+        char ca[2] = { a.charAt(i), 0 }, cb[2] = { b.charAt(i), 0 };
+        int w = sprite.textWidth(ca);
+        if (w != sprite.textWidth(cb)) return;
+        if (ca[0] != cb[0]) {
+            first = std::min(first, x);
+            last  = std::max(last, x + w);
+        }
+        x += w;
     }
+    x1 = first;
+    x2 = last;
+}
+
+// Numbers come from the pre-rendered digits when possible
+void draw_centered(const String& text, int fg, int bg, int font, int size) {
+    int x = display.width()/2, y = display.height()/2;
+    if (size == 1 && digits.built(font)) {
+        if (digits.draw(sprite, text.c_str(), x, y, ink(fg), ink(bg))) return;
+    }
+    sprite.drawString(text, x, y);
 }
 
 void display_big(const String& text, int fg = TFT_WHITE, int bg = TFT_BLACK) {
-    clear_sprite(bg);
-    sprite.setTextSize(1);
+    std::lock_guard<std::mutex> lock(display_mutex);
+    bool border = WiFi.status() == WL_CONNECTED;
+    bool same_style = shown.valid && fg == shown.fg && bg == shown.bg && border == shown.border;
+    if (same_style && text == shown.text) return;
+
     bool nondigits = false;
     for (int i = 0; i < text.length(); i++) {
         char c = text.charAt(i);
         if (c < '0' || c > '9') nondigits = true;
     }
-    sprite.setTextFont(nondigits ? 4 : 8);
-    sprite.setTextSize(nondigits && text.length() < 10 ? 2 : 1);
+    int font = nondigits ? 4 : 8;
+    int size = nondigits && text.length() < 10 ? 2 : 1;
+    bool same_font = same_style && font == shown.font && size == shown.size;
+
+    pusher.fence();
+    if (!same_font) clear_sprite(bg);
+    sprite.setTextFont(font);
+    sprite.setTextSize(size);
     sprite.setTextDatum(MC_DATUM);
-    sprite.setTextColor(fg, bg);
-    sprite.drawString(text, display.width()/2, display.height()/2);
+    sprite.setTextColor(ink(fg), ink(bg));
+
+    if (same_font) {
+        // Only the text changed: repaint and push just the glyphs that differ
+        int x1, x2;
+        changed_span(shown.text, text, x1, x2);
+        int h = sprite.fontHeight();
+        int y1 = display.height()/2 - h/2, y2 = y1 + h;
+        x1 = std::max(x1, 0);
+        y1 = std::max(y1, 0);
+        x2 = std::min(x2, (int) display.width());
+        y2 = std::min(y2, (int) display.height());
+
+        sprite.fillRect(x1, y1, x2 - x1, y2 - y1, ink(bg));
+        draw_centered(text, fg, bg, font, size);
+        if (border) sprite.drawRect(0, 0, display.width(), display.height(), ink(TFT_BLUE));
+        pusher.push(x1, y1, x2 - x1, y2 - y1);
+    } else {
+        draw_centered(text, fg, bg, font, size);
+        pusher.push();
+    }
 
-    sprite.pushSprite(0, 0);
+    shown.text   = text;
+    shown.fg     = fg;
+    shown.bg     = bg;
+    shown.font   = font;
+    shown.size   = size;
+    shown.border = border;
+    shown.valid  = true;
 }
 
-void display_lines(const std::list<String>& lines, int fg = TFT_WHITE, int bg = TFT_BLACK) {
+// Lines end at a nullptr; `from`, if given, is replaced by `to` in each line
+void display_lines(const char* const* lines, int fg = TFT_WHITE, int bg = TFT_BLACK, const char* from = nullptr, const char* to = nullptr) {
+    int count = 0;
+    while (lines[count]) count++;
+
+    std::lock_guard<std::mutex> lock(display_mutex);
+    pusher.fence();
     clear_sprite(bg);
     sprite.setTextSize(1);
     sprite.setTextFont(4);
     sprite.setTextDatum(MC_DATUM);
-    sprite.setTextColor(fg, bg);
+    sprite.setTextColor(ink(fg), ink(bg));
 
     const int line_height = 32;
-    int y = display.height()/2 - (lines.size()-1) * line_height/2;
-    for (auto line : lines) {
+    int y = display.height()/2 - (count-1) * line_height/2;
+    for (int i = 0; i < count; i++) {
+        const char* line = lines[i];
+        const char* found = from ? strstr(line, from) : nullptr;
+        char buf[64];
+        if (found) {
+            snprintf(buf, sizeof(buf), "%.*s%s%s", (int) (found - line), line, to, found + strlen(from));
+            line = buf;
+        }
         sprite.drawString(line, display.width()/2, y);
         y += line_height;
     }
-    sprite.pushSprite(0, 0);
+    pusher.push();
 }
 
+// The logo has more colours than the palette, so it goes straight to the
+// display; the sprite no longer matches what is shown.
 void display_logo() {
-    clear_sprite();
-    sprite.setSwapBytes(true);
-    sprite.pushImage(12, 30, 215, 76, OPERAME_LOGO);
-    sprite.pushSprite(0, 0);
+    std::lock_guard<std::mutex> lock(display_mutex);
+    shown.valid = false;
+    graphed.valid = false;
+    pusher.flush();
+    display.startWrite();
+    display.fillScreen(TFT_BLACK);
+    if (WiFi.status() == WL_CONNECTED) {
+        display.drawRect(0, 0, display.width(), display.height(), TFT_BLUE);
+    }
+    OperameImage::draw(display, 12, 30, OPERAME_LOGO);
+    display.endWrite();
 }
 
 void display_ppm(int ppm) {
@@ -113,22 +301,126 @@ void display_ppm(int ppm) {
     display_big(String(ppm), fg, bg);
 }
 
+int level_color(int ppm) {
+    return ppm >= co2_critical ? TFT_RED : ppm >= co2_warning ? TFT_YELLOW : TFT_GREEN;
+}
+
+// Trend screen: a bar per minute for the last hour, newest on the right,
+// from the minute rollups. Scrolling at 4 bpp is only fast for even offsets
+// and widths, hence the bar width and the even margins.
+const int graph_bar = 4;   // pixels per minute
+const int graph_top = 28;  // below the current reading
+
+void graph_area(int& x, int& y, int& w, int& h) {
+    x = 2;
+    y = graph_top;
+    w = (display.width() - 4) / graph_bar * graph_bar;
+    h = display.height() - 1 - graph_top;
+}
+
+int graph_y(int ppm, int h) {
+    int top = 2 * co2_critical;  // fixed, so that old bars stay valid
+    long y = (long) (ppm - 400) * h / (top - 400);
+    return h - (int) std::max(0L, std::min(y, (long) h));
+}
+
+// Bar `column` minutes left of the newest; `b` is nullptr for no readings
+void draw_bar(int column, const OperameRollup::Bucket* b) {
+    int x, y, w, h;
+    graph_area(x, y, w, h);
+    x += w - (column + 1) * graph_bar;
+    sprite.fillRect(x, y, graph_bar, h, ink(TFT_BLACK));
+    if (b && b->count) {
+        int top = graph_y(b->avg(), h);
+        sprite.fillRect(x, y + top, graph_bar, h - top, ink(level_color(b->avg())));
+    }
+    for (int level : { co2_warning, co2_critical }) {
+        for (int i = x; i < x + graph_bar; i += 2) sprite.drawPixel(i, y + graph_y(level, h), ink(TFT_WHITE));
+    }
+}
+
+// Draws the bars for minutes after `since`, up to `newest`
+void draw_bars(uint32_t since, uint32_t newest) {
+    const auto& minutes = rollups.minutes;
+    uint32_t before = newest + 1;
+    for (int ago = 1; ago < 60; ago++) {
+        // The sensor task may move the ring on meanwhile, which brings back
+        // the bucket just drawn, or one newer than `newest`
+        OperameRollup::Bucket b = minutes.read(ago);
+        if (b.start >= before) continue;
+        if (!b.count || b.start <= since) break;
+        draw_bar((newest - b.start) / 60, &b);
+        before = b.start;
+    }
+}
+
+// Only what changed is drawn and pushed: once a minute the bars scroll one
+// step to the left to make room for the new one, and the number on top is
+// redrawn when the reading changes. The first time, the whole screen goes,
+// margins included, as the previous screen is still on the display.
+void display_graph(int co2) {
+    std::lock_guard<std::mutex> lock(display_mutex);
+    int x, y, w, h;
+    graph_area(x, y, w, h);
+    int bars = w / graph_bar;
+    // Complete minutes only; the current one is still being written by the
+    // sensor task
+    uint32_t newest = rollups.minutes.read(1).start;
+    bool full = !graphed.valid;
+
+    pusher.fence();
+    if (full) {
+        clear_sprite();
+        for (int column = 0; column < bars; column++) draw_bar(column, nullptr);
+        draw_bars(0, newest);
+        graphed = { newest, -1, true };
+    } else if (newest != graphed.newest) {
+        int shift = std::min((newest - graphed.newest) / 60, (uint32_t) bars);
+        sprite.setScrollRect(x, y, w, h, ink(TFT_BLACK));
+        sprite.scroll(-shift * graph_bar);
+        for (int column = 0; column < shift; column++) draw_bar(column, nullptr);
+        draw_bars(graphed.newest, newest);
+        graphed.newest = newest;
+        pusher.push(x, y, w, h);
+    }
+
+    if (co2 != graphed.co2) {
+        pusher.fence();
+        sprite.fillRect(x, 2, w, graph_top - 3, ink(TFT_BLACK));
+        sprite.setTextFont(4);
+        sprite.setTextSize(1);
+        sprite.setTextDatum(TC_DATUM);
+        sprite.setTextColor(ink(level_color(co2)), ink(TFT_BLACK));
+        sprite.drawString(String(co2), display.width()/2, 2);
+        graphed.co2 = co2;
+        if (!full) pusher.push(x, 2, w, graph_top - 3);
+    }
+    if (full) pusher.push();
+}
+
 void calibrate() {
-    auto lines = T.calibration;
+    OperameLanguage::Lines lines;
+    memcpy(lines, T->calibration, sizeof(lines));
+    int last = 0;
+    while (lines[last + 1]) last++;
+
+    char countdown[4];
+    lines[last] = countdown;
     for (int count = 60; count >= 0; count--) {
-        lines.back() = String(count);
+        snprintf(countdown, sizeof(countdown), "%d", count);
         display_lines(lines, TFT_RED);
         unsigned long start = millis();
         while (millis() - start < 1000) {
-            if (button(pin_demobutton) || button(pin_portalbutton)) return;
+            if (button() >= 0) return;
+            delay(10);
         }
     }
 
-    lines = T.calibrating;
-    if (driver == AQC) for (auto& line : lines) line.replace("400", "425");
-    display_lines(lines, TFT_MAGENTA);
+    char zero[8];
+    snprintf(zero, sizeof(zero), "%d", sensor.zero_ppm());
+    display_lines(T->calibrating, TFT_MAGENTA, TFT_BLACK, "400", zero);
 
-    set_zero();    // actually instantaneous
+    zero_requested = true;  // handled by the sensor task within a second
     delay(15000);  // give time to read long message
 }
 
@@ -140,18 +432,19 @@ void ppm_demo() {
     int buttoncounter = 0;
     for (int p = 400; p < 1200; p++) {
         display_ppm(p);
-        if (button(pin_demobutton)) {
+        if (button() == pin_demobutton) {
             display_logo();
             delay(500);
             return;
         }
 
         // Hold portal button from 700 to 800 for manual calibration
-        if (p >= 700 && p < 800 && !digitalRead(pin_portalbutton)) {
+        if (p >= 700 && p < 800 && buttons.held_for(pin_portalbutton)) {
             buttoncounter++;
         }
         if (p == 800 && buttoncounter >= 85) {
-            while (!digitalRead(pin_portalbutton)) delay(100);
+            while (buttons.held_for(pin_portalbutton)) delay(100);
+            buttons.clear();  // the hold was the gesture, not a press
             calibrate();
             display_logo();
             delay(500);
@@ -169,26 +462,26 @@ void panic(const String& message) {
     ESP.restart();
 }
 
-bool button(int pin) {
-    if (digitalRead(pin)) return false;
-    unsigned long start = millis();
-    while (!digitalRead(pin)) {
-        if (millis() - start >= 50) display_big("");
-    }
-    return millis() - start >= 50;
+int button() {
+    // Pin of the next button press, or -1
+    OperameButtons::Event event;
+    return buttons.next(event) ? event.pin : -1;
 }
 
 void check_portalbutton() {
-    if (button(pin_portalbutton)) WiFiSettings.portal();
-}
-
-void check_demobutton() {
-    if (button(pin_demobutton)) ppm_demo();
+    if (button() == pin_portalbutton) WiFiSettings.portal();
 }
 
 void check_buttons() {
-    check_portalbutton();
-    check_demobutton();
+    OperameButtons::Event event;
+    if (buttons.next(event)) {
+        if (event.pin == pin_portalbutton) WiFiSettings.portal();
+        if (event.pin == pin_demobutton && event.type == OperameButtons::PRESS) graph_shown = !graph_shown;
+        if (event.pin == pin_demobutton && event.type == OperameButtons::LONG_PRESS) ppm_demo();
+    }
+
+    // Long presses need polling, idle buttons only their interrupt
+    if (power_save && buttons.idle()) ui_jobs.pause(buttons_job);
 }
 
 void setup_ota() {
@@ -204,119 +497,131 @@ void setup_ota() {
     ArduinoOTA.begin();
 }
 
+OperameStats::Histogram connect_time;
+OperameStats::Histogram rollup_time;
+
 void connect_mqtt() {
     if (mqtt.connected()) return;  // already/still connected
+    OperameStats::Timer timer(connect_time);
 
     static int failures = 0;
     if (mqtt.connect(WiFiSettings.hostname.c_str())) {
         failures = 0;
     } else {
         failures++;
-        if (failures >= max_failures) panic(T.error_mqtt);
+        // Readings wait in the outbox; restarting only helps a stuck WiFi link,
+        // not a broker that is down
+        if (failures >= max_failures && WiFi.status() != WL_CONNECTED) panic(T->error_mqtt);
     }
 }
 
-void flush(Stream& s, int limit = 20) {
-    // .available() sometimes stays true (why?), hence the limit
-
-    s.flush();  // flush output
-    while(s.available() && --limit) s.read();  // flush input
+String slurp(const char* path) {
+    File f = SPIFFS.open(path, FILE_READ);
+    return f ? f.readString() : String();
 }
 
-int aqc_get_co2() {
-    static bool initialized = false;
+// Tries the access point of the last boot first, on its channel, which saves
+// scanning all channels; with wifi_reuse_ip it also skips DHCP. Falls back to
+// WiFiSettings, which does the full connect.
+void connect_wifi() {
+    unsigned long start = millis();
+    OperameWiFi::Cache cache;
+    if (OperameWiFi::load(cache) && slurp("/wifi-ssid") == cache.ssid) {
+        String password = slurp("/wifi-password");  // as stored by WiFiSettings
+        wifi_fast = OperameWiFi::reconnect(cache, password.c_str(), wifi_reuse_ip, 4000, [] { WiFiSettings.onConnect(); });
+    }
+    if (!wifi_fast) WiFiSettings.connect(false, 15);
+    if (WiFi.status() != WL_CONNECTED) return;
 
-    const uint8_t command[9] = { 0xff, 0x01, 0xc5, 0, 0, 0, 0, 0, 0x3a };
-    uint8_t response[9];
-    int co2 = -1;
+    wifi_connected_at = millis();
+    OperameWiFi::remember();
+    Serial.printf("WiFi %s in %lu ms\n", wifi_fast ? "reconnected" : "connected", millis() - start);
+}
 
-    for (int attempt = 0; attempt < 3; attempt++) {
-        flush(hwserial1);
-        hwserial1.write(command, sizeof(command));
-        delay(50);
+// Read before the driver probe, so that a trace covers the sensor's start-up.
+// A trace in flash is appended to across restarts and printed on the serial
+// console once capturing is switched to Serial.
+void setup_capture() {
+    const char* path = "/capture.txt";
+    int capture = WiFiSettings.integer("operame_capture", 0, 2, 0, T->config_capture);
 
-        size_t c = hwserial1.readBytes(response, sizeof(response));
-        if (c != sizeof(response) || response[0] != 0xff || response[1] != 0x86) {
-            continue;
-        }
-        uint8_t checksum = 255;
-        for (int i = 0; i < sizeof(response) - 1; i++) {
-            checksum -= response[i];
-        }
-        if (response[8] == checksum) {
-            co2 = response[2] * 256 + response[3];
-            break;
-        }
-        delay(50);
+    if (capture == 0) {
+        if (SPIFFS.exists(path)) SPIFFS.remove(path);
+        return;
     }
 
-    if (co2 < 0) {
-        initialized = false;
-        return co2;
+    if (capture == 1) {
+        File f = SPIFFS.open(path, FILE_READ);
+        uint8_t buf[256];
+        while (f && f.available()) Serial.write(buf, f.read(buf, sizeof(buf)));
+        f.close();
+        sensor_serial.start(Serial);
+        return;
     }
 
-    if (!initialized && (co2 == 9999 || co2 == 400)) return 0;
-    initialized = true;
-    return co2;
-}
-
-void aqc_set_zero() {
-    const uint8_t command[9] = { 0xff, 0x01, 0x87, 0, 0, 0, 0, 0, 0x78 };
-    flush(hwserial1);
-    hwserial1.write(command, sizeof(command));
-}
-
-void mhz_setup() {
-    mhz.begin(hwserial1);
-    // mhz.setFilter(true, true);  Library filter doesn't handle 0436
-    mhz.autoCalibration(true);
-    char v[5] = {};
-    mhz.getVersion(v);
-    v[4] = '\0';
-    if (strcmp("0436", v) == 0) mhz_co2_init = 436;
+    capture_file = SPIFFS.open(path, FILE_APPEND);
+    const size_t max_size = 256 * 1024;
+    if (capture_file && capture_file.size() < max_size) {
+        sensor_serial.start(capture_file, max_size - capture_file.size());
+    }
 }
 
-int mhz_get_co2() {
-    int co2       = mhz.getCO2();
-    int unclamped = mhz.getCO2(false);
-
-    if (mhz.errorCode != RESULT_OK) {
-        delay(500);
-        mhz_setup();
-        return -1;
+// Probing for an AQC sensor takes over three seconds when there is none, so
+// the driver that found a sensor is remembered for the next boot. Should it
+// fail max_cached_failures times in a row before the sensor ever answered,
+// it is forgotten and the device restarts to probe.
+const int max_cached_failures = 3;  // a single one may be a glitch on the line
+
+void setup_sensor() {
+    const char* path = "/sensor-driver";
+    char cached[16] = "";
+    File f = SPIFFS.open(path, FILE_READ);
+    if (f) cached[f.read((uint8_t*) cached, sizeof(cached) - 1)] = '\0';
+    f.close();
+
+    sensor_cached = cached[0] && sensor.select(cached);
+    if (!sensor_cached) {
+        if (!sensor.probe()) panic(T->error_driver);
+        f = SPIFFS.open(path, FILE_WRITE);
+        if (f) f.print(sensor.name());
+        f.close();
     }
-
-    // reimplement filter from library, but also checking for 436 because our
-    // sensors (firmware 0436, coincidence?) return that instead of 410...
-    if (unclamped == mhz_co2_init && co2 - unclamped >= 10) return 0;
-
-    // No known sensors support >10k PPM (library filter tests for >32767)
-    if (co2 > 10000 || unclamped > 10000) return 0;
-
-    return co2;
+    Serial.printf("Using %s driver%s.\n", sensor.name(), sensor_cached ? " (cached)" : "");
 }
 
-void mhz_set_zero() {
-    mhz.calibrate();
+void render_metrics(Print& out) {
+    Reading reading;
+    co2_reading.read(reading);
+    int co2 = reading.co2;
+    out.printf("# HELP operame_co2_ppm Last reading; 0 while warming up, -1 after an error\n");
+    out.printf("# TYPE operame_co2_ppm gauge\noperame_co2_ppm %d\n", co2);
+    out.printf("# TYPE operame_co2_warning_ppm gauge\noperame_co2_warning_ppm %d\n", co2_warning);
+    out.printf("# TYPE operame_co2_critical_ppm gauge\noperame_co2_critical_ppm %d\n", co2_critical);
+    out.printf("# HELP operame_uptime_seconds At the last reading\n");
+    out.printf("# TYPE operame_uptime_seconds counter\noperame_uptime_seconds %lu\n", (unsigned long) reading.uptime);
+    OperameRollup::metrics(out, rollups);
 }
 
-int get_co2() {
-    // <0 means read error, 0 means still initializing, >0 is PPM value
-
-    if (driver == AQC) return aqc_get_co2();
-    if (driver == MHZ) return mhz_get_co2();
-
-    // Should be unreachable
-    panic(T.error_driver);
-    return -1;  // suppress warning
+void render_history(Print& out) {
+    OperameRollup::json(out, rollups);
 }
 
-void set_zero() {
-    if (driver == AQC) { aqc_set_zero(); return; }
-    if (driver == MHZ) { mhz_set_zero(); return; }
-
-    // Should be unreachable
-    panic(T.error_driver);
+OperameHTTP::Server http_server(80);
+OperameHTTP::Document<2048> metrics_page("/metrics", "text/plain; version=0.0.4", render_metrics);
+OperameHTTP::Document<4096> history_page("/history.json", "application/json", render_history);
+
+// The pages change only with a new reading, and are formatted again at the
+// first request after one
+void serve_http() {
+    static uint32_t seen = 0;
+    Reading reading;
+    uint32_t seq = co2_reading.read(reading);
+    if (seq != seen) {
+        seen = seq;
+        metrics_page.invalidate();
+        history_page.invalidate();
+    }
+    http_server.poll();
 }
 
 void setup() {
@@ -327,83 +632,103 @@ void setup() {
     display.init();
     display.fillScreen(TFT_BLACK);
     display.setRotation(1);
+    sprite.setColorDepth(4);
     sprite.createSprite(display.width(), display.height());
+    sprite.createPalette(palette, sizeof(palette) / sizeof(*palette));
+    digits.build(sprite, 8);
+    sprite.fillSprite(ink(TFT_BLACK));
+    // A simulation on the host cannot have a task wait for frames
+    bool display_task_enabled = OperameTasks::preemptive();
+    pusher.begin(display, sprite, palette, sizeof(palette) / sizeof(*palette), display_task_enabled);
+    if (display_task_enabled) OperameTasks::spawn("display", display_task, 1, 4096, 2);
 
-    OperameLanguage::select(T, LANGUAGE);
+    T = OperameLanguage::select(LANGUAGE);
 
     if (!SPIFFS.begin(false)) {
-        display_lines(T.first_run, TFT_MAGENTA);
+        display_lines(T->first_run, TFT_MAGENTA);
         if (!SPIFFS.format()) {
-            display_big(T.error_format, TFT_RED);
+            display_big(T->error_format, TFT_RED);
             delay(20*1000);
         }
     }
+    history.begin(5);
+    rollups.begin(uptime());
 
     pinMode(pin_portalbutton,   INPUT_PULLUP);
     pinMode(pin_demobutton,     INPUT_PULLUP);
     pinMode(pin_pcb_ok,         INPUT_PULLUP);
     pinMode(pin_backlight,      OUTPUT);
+    buttons.add(pin_portalbutton);
+    buttons.add(pin_demobutton);
 
     WiFiSettings.hostname = "operame-";
     WiFiSettings.language = LANGUAGE;
     WiFiSettings.begin();
-    OperameLanguage::select(T, WiFiSettings.language);
+    T = OperameLanguage::select(WiFiSettings.language);
 
     while (digitalRead(pin_pcb_ok)) {
-        display_big(T.error_module, TFT_RED);
+        display_big(T->error_module, TFT_RED);
         delay(1000);
     }
 
+    // The logo stays up for two seconds while the sensor starts warming up
+    // and WiFi associates behind it
     display_logo();
-    delay(2000);
+    static unsigned long logo_shown = millis();
 
     hwserial1.begin(9600, SERIAL_8N1, pin_sensor_rx, pin_sensor_tx);
+    setup_capture();
+    setup_sensor();
 
-    if (aqc_get_co2() >= 0) {
-        driver = AQC;
-        hwserial1.setTimeout(100);
-        Serial.println("Using AQC driver.");
-    } else {
-        driver = MHZ;
-        mhz_setup();
-        Serial.println("Using MHZ driver.");
-    }
-
-
-    for (auto& str : T.portal_instructions[0]) {
-        str.replace("{ssid}", WiFiSettings.hostname);
-    }
-
-    wifi_enabled  = WiFiSettings.checkbox("operame_wifi", false, T.config_wifi);
-    ota_enabled   = WiFiSettings.checkbox("operame_ota", false, T.config_ota) && wifi_enabled;
+    // Read before the sensor task starts, which uses the CO2 levels; the
+    // portal lists the settings in this order
+    wifi_enabled  = WiFiSettings.checkbox("operame_wifi", false, T->config_wifi);
+    wifi_reuse_ip = WiFiSettings.checkbox("operame_wifi_reuse_ip", false, T->config_wifi_reuse_ip);
+    ota_enabled   = WiFiSettings.checkbox("operame_ota", false, T->config_ota) && wifi_enabled;
+    power_save    = WiFiSettings.checkbox("operame_power_save", false, T->config_power_save);
+    http_enabled  = WiFiSettings.checkbox("operame_http", false, T->config_http) && wifi_enabled;
 
     WiFiSettings.heading("CO2-niveaus");
-    co2_warning   = WiFiSettings.integer("operame_co2_warning", 400, 5000, 700, T.config_co2_warning);
-    co2_critical  = WiFiSettings.integer("operame_co2_critical",400, 5000, 800, T.config_co2_critical);
-    co2_blink     = WiFiSettings.integer("operame_co2_blink",   800, 5000, 800, T.config_co2_blink);
+    co2_warning   = WiFiSettings.integer("operame_co2_warning", 400, 5000, 700, T->config_co2_warning);
+    co2_critical  = WiFiSettings.integer("operame_co2_critical",400, 5000, 800, T->config_co2_critical);
+    co2_blink     = WiFiSettings.integer("operame_co2_blink",   800, 5000, 800, T->config_co2_blink);
+
+    sensor_jobs.add("request", sensor_request, 5000);
+    sensor_poll_job = sensor_jobs.add("poll", sensor_poll, 2);
+    sensor_jobs.add("zero", sensor_zero, 1000);
+    sensor_jobs.add("history", sensor_history, 60 * 1000);
+    if (sensor_serial.recording()) sensor_jobs.add("capture", [] { sensor_serial.poll(); }, 1000);
+    OperameTasks::spawn("sensor", sensor_task, 1, 4096);
 
     WiFiSettings.heading("MQTT");
-    mqtt_enabled  = WiFiSettings.checkbox("operame_mqtt", false, T.config_mqtt) && wifi_enabled;
-    String server = WiFiSettings.string("mqtt_server", 64, "", T.config_mqtt_server);
-    int port      = WiFiSettings.integer("mqtt_port", 0, 65535, 1883, T.config_mqtt_port);
-    max_failures  = WiFiSettings.integer("operame_max_failures", 0, 1000, 10, T.config_max_failures);
-    mqtt_topic  = WiFiSettings.string("operame_mqtt_topic", WiFiSettings.hostname, T.config_mqtt_topic);
-    mqtt_interval = 1000UL * WiFiSettings.integer("operame_mqtt_interval", 10, 3600, 60, T.config_mqtt_interval);
-    mqtt_template = WiFiSettings.string("operame_mqtt_template", "{} PPM", T.config_mqtt_template);
-    WiFiSettings.info(T.config_template_info);
+    mqtt_enabled  = WiFiSettings.checkbox("operame_mqtt", false, T->config_mqtt) && wifi_enabled;
+    String server = WiFiSettings.string("mqtt_server", 64, "", T->config_mqtt_server);
+    int port      = WiFiSettings.integer("mqtt_port", 0, 65535, 1883, T->config_mqtt_port);
+    max_failures  = WiFiSettings.integer("operame_max_failures", 0, 1000, 10, T->config_max_failures);
+    mqtt_topic  = WiFiSettings.string("operame_mqtt_topic", WiFiSettings.hostname, T->config_mqtt_topic);
+    mqtt_interval = 1000UL * WiFiSettings.integer("operame_mqtt_interval", 10, 3600, 60, T->config_mqtt_interval);
+    mqtt_template = WiFiSettings.string("operame_mqtt_template", "{} PPM", T->config_mqtt_template);
+    mqtt_backlog_topic = mqtt_topic + "/backlog";
+    message_template.parse(mqtt_template.c_str());
+    WiFiSettings.info(T->config_template_info);
+    mqtt_batch    = WiFiSettings.integer("operame_mqtt_batch", 1, 50, 10, T->config_mqtt_batch);
+    mqtt_rate     = WiFiSettings.integer("operame_mqtt_rate", 1, 10, 2, T->config_mqtt_rate);
+    mqtt_stats    = WiFiSettings.checkbox("operame_mqtt_stats", false, T->config_mqtt_stats);
+    mqtt_stats_topic = mqtt_topic + "/stats";
 
     WiFiSettings.onConnect = [] {
-        display_big(T.connecting, TFT_BLUE);
+        if (millis() - logo_shown >= 2000) display_big(T->connecting, TFT_BLUE);
         check_portalbutton();
         return 50;
     };
     WiFiSettings.onFailure = [] {
-        display_big(T.error_wifi, TFT_RED);
+        display_big(T->error_wifi, TFT_RED);
         delay(2000);
     };
     static int portal_phase = 0;
     static unsigned long portal_start;
     WiFiSettings.onPortal = [] {
+        portal_active = true;
         if (ota_enabled) setup_ota();
         portal_start = millis();
     };
@@ -417,56 +742,312 @@ void setup() {
         if (WiFi.softAPgetStationNum() == 0) portal_phase = 0;
         else if (! portal_phase) portal_phase = 1;
 
-        display_lines(T.portal_instructions[portal_phase], TFT_WHITE, TFT_BLUE);
+        display_lines(T->portal_instructions[portal_phase], TFT_WHITE, TFT_BLUE, "{ssid}", WiFiSettings.hostname.c_str());
 
         if (portal_phase == 0 && millis() - portal_start > 10*60*1000) {
-            panic(T.error_timeout);
+            panic(T->error_timeout);
         }
 
         if (ota_enabled) ArduinoOTA.handle();
-        if (button(pin_portalbutton)) ESP.restart();
+        if (button() == pin_portalbutton) ESP.restart();
     };
 
-    if (wifi_enabled) WiFiSettings.connect(false, 15);
+    if (wifi_enabled) connect_wifi();
+
+    if (power_save) {
+        buttons.wake_from_sleep();
+        power_mode = OperamePower::begin(wifi_enabled);
+        Serial.printf("Power saving: %s\n", OperamePower::name(power_mode));
+    }
 
     static WiFiClient wificlient;
     if (mqtt_enabled) mqtt.begin(server.c_str(), port, wificlient);
 
     if (ota_enabled) setup_ota();
-}
 
-#define every(t) for (static unsigned long _lasttime; (unsigned long)((unsigned long)millis() - _lasttime) >= (t); _lasttime = millis())
+    if (mqtt_enabled) {
+        restore_outbox();
+        network_jobs.add("mqtt", [] { mqtt.loop(); }, power_save ? 1000 : 50);
+        network_jobs.add("collect", collect_co2, 1000);
+        network_jobs.add("publish", publish_co2, mqtt_interval, mqtt_interval);
+        network_jobs.add("outbox", drain_outbox, 1000 / mqtt_rate);
+        if (mqtt_stats) network_jobs.add("stats", publish_report, 60000, 60000);
+    }
+    if (ota_enabled) network_jobs.add("ota", [] { ArduinoOTA.handle(); }, 10);
+    if (http_enabled) {
+        http_server.add(metrics_page);
+        http_server.add(history_page);
+        http_server.begin();
+        network_jobs.add("http", serve_http, power_save ? 100 : 10);
+    }
+
+    // The UI runs in loop(), on the Arduino task on core 1, as does the
+    // sensor task started above. WiFi runs on core 0.
+    if (wifi_enabled) OperameTasks::spawn("network", network_task, 0);
 
-void loop() {
-    static int co2;
+    while (millis() - logo_shown < 2000) delay(10);
+
+    // Buttons wake the UI task, so in power-saving mode it can poll them
+    // and redraw less often without feeling slow
+    render_job  = ui_jobs.add("render", render, power_save ? 500 : 50);
+    buttons_job = ui_jobs.add("buttons", check_buttons, power_save ? 100 : 10);
+    buttons.on_edge = wake_ui;
+    ui_jobs.add("report", report, 60000, 60000);
+}
+
+void sensor_request() {
+    sensor.request();
+    sensor_jobs.resume(sensor_poll_job);
+}
 
-    every(5000) {
-        co2 = get_co2();
+void sensor_poll() {
+    int co2;
+    if (sensor.read(co2)) {
+        if (co2 >= 0) sensor_cached = false;  // it answers, so it is the right one
+        if (sensor_cached && ++cached_failures >= max_cached_failures) {
+            SPIFFS.remove("/sensor-driver");
+            ESP.restart();
+        }
+        if (co2 > 0 && !first_reading_at) {
+            first_reading_at = millis();
+            Serial.printf("First reading after %lu ms\n", millis());
+        }
         Serial.println(co2);
+        co2_reading.publish({ co2, uptime() });
+        history.add(uptime(), co2);
+        OperameStats::Timer timer(rollup_time);
+        rollups.add(uptime(), co2, co2_warning, co2_critical);
     }
+    if (!uart.busy()) sensor_jobs.pause(sensor_poll_job);
+}
 
-    every(50) {
-        if (co2 < 0) {
-            display_big(T.error_sensor, TFT_RED);
-        } else if (co2 == 0) {
-            display_big(T.wait);
-        } else {
-            // some MH-Z19's go to 10000 but the display has space for 4 digits
-            display_ppm(co2 > 9999 ? 9999 : co2);
-        }
+void sensor_zero() {
+    if (zero_requested.exchange(false)) sensor.set_zero();
+}
+
+void sensor_history() {
+    history.poll(uptime());
+}
+
+void sensor_task() {
+    sensor_jobs.run();
+    sensor_jobs.wait();
+}
+
+// Readings since the previous publication, for {min}, {max} and {avg}
+struct {
+    int     min, max;
+    long    sum;
+    int     count;
+} since_publish;
+
+void collect_co2() {
+    static uint32_t seen = 0;
+    Reading reading;
+    uint32_t seq = co2_reading.read(reading);
+    if (seq == seen) return;
+    seen = seq;
+    int co2 = reading.co2;
+    if (co2 <= 0) return;
+
+    auto& s = since_publish;
+    s.min = s.count ? std::min(s.min, co2) : co2;
+    s.max = s.count ? std::max(s.max, co2) : co2;
+    s.sum += co2;
+    s.count++;
+
+    // Rather than wait a whole interval after boot
+    static bool early = false;
+    if (!early) {
+        early = true;
+        publish_co2();
     }
+}
 
-    if (mqtt_enabled) {
-        mqtt.loop();
-        every(mqtt_interval) {
-            if (co2 <= 0) break;
-            connect_mqtt();
-            String message = mqtt_template;
-            message.replace("{}", String(co2));
-            retain(mqtt_topic, message);
-        }
+void publish_co2() {
+    Reading reading;
+    co2_reading.read(reading);
+    int co2 = reading.co2;
+    if (co2 <= 0) return;
+
+    auto& s = since_publish;
+    OperameTemplate::Values values = {
+        co2, uptime(), WiFiSettings.hostname.c_str(),
+        s.count ? s.min : co2,
+        s.count ? s.max : co2,
+        s.count ? (int) (s.sum / s.count) : co2
+    };
+    s.count = 0;
+    s.sum = 0;
+
+    char message[256];
+    size_t length = message_template.render(message, sizeof(message), values);
+    connect_mqtt();
+    if (!mqtt.connected() || !retain(mqtt_topic, message, length)) {
+        // So that a restart during the outage can find these in the history
+        if (outbox.empty()) OperameHistory::set_mark(history.first_sequence(), values.uptime);
+        outbox.push(values.uptime, co2);
+    } else if (!first_publish_at) {
+        first_publish_at = millis();
+        Serial.printf("First publish after %lu ms\n", millis());
     }
+}
+
+void drain_outbox() {
+    // Catch up on readings missed during an outage, oldest first, as lines of
+    // "<seconds ago> <message>" on a non-retained subtopic
+    if (outbox.empty() || !mqtt.connected()) return;
+
+    static char payload[1536];  // fits the MQTT buffer
+    size_t length = 0, n = 0;
+    uint32_t now = uptime();
+    while (n < outbox.size() && n < (size_t) mqtt_batch) {
+        auto& entry = outbox.at(n);
+        OperameTemplate::Values values = {
+            entry.co2, (uint32_t) std::max(entry.time, 0), WiFiSettings.hostname.c_str(), entry.co2, entry.co2, entry.co2
+        };
+        char line[256];
+        size_t l = OperameTemplate::append(line, sizeof(line), 0, now - entry.time);
+        l = OperameTemplate::append(line, sizeof(line), l, " ", 1);
+        l += message_template.render(line + l, sizeof(line) - l - 1, values);
+        line[l++] = '\n';
+        if (length + l >= sizeof(payload)) break;
+        memcpy(payload + length, line, l);
+        length += l;
+        n++;
+    }
+    Serial.printf("%s %u readings\n", mqtt_backlog_topic.c_str(), (unsigned) n);
+    if (mqtt.publish(mqtt_backlog_topic.c_str(), payload, length, false, 0)) {
+        outbox.pop(n);
+        if (outbox.empty()) OperameHistory::clear_mark();
+    }
+}
+
+// Readings that were still waiting when the Operame restarted are in the
+// history log. They go back into the outbox, one per publish interval, aged
+// as if the restart had taken no time. Those of a batch that was published
+// but not yet cleared from the mark may be sent twice.
+void restore_outbox() {
+    OperameHistory::Mark mark;
+    if (!OperameHistory::get_mark(mark)) return;
+
+    uint32_t interval = mqtt_interval / 1000, previous = 0;
+    bool first = true;
+    OperameHistory::since(mark, history.first_sequence(), [&](uint32_t ago, int co2) {
+        if (!first && previous - ago < interval) return;
+        first = false;
+        previous = ago;
+        outbox.push(-(int32_t) ago, co2);
+    });
+    Serial.printf("%s %u readings from before the restart\n", mqtt_backlog_topic.c_str(), (unsigned) outbox.size());
+    if (outbox.empty()) OperameHistory::clear_mark();
+}
+
+void network_task() {
+    if (portal_active) {
+        // The portal has taken over WiFi; it ends in a restart
+        delay(100);
+        return;
+    }
+    network_jobs.run();
+    network_jobs.wait();
+}
+
+void display_task() {
+    pusher.run();
+}
+
+// Run counts, lateness and runtime percentiles of every job
+void print_report(Print& out) {
+    ui_jobs.report(out);
+    sensor_jobs.report(out);
+    network_jobs.report(out);
+    out.printf("%-10s %8lu runs, ", "connect", (unsigned long) connect_time.count());
+    connect_time.report(out);
+    out.println();
+    out.printf("%-10s %8lu runs, ", "rollup", (unsigned long) rollup_time.count());
+    rollup_time.report(out);
+    out.println();
+    if (http_enabled) http_server.report(out);
+    OperameRollup::report(out, rollups);
+    pusher.report(out);
+    out.printf("power: saving %s", OperamePower::name(power_mode));
+    if (power_mode == OperamePower::NAPS) out.printf(", asleep %lu%% of the time", (unsigned long) (napped_us / 10 / std::max(esp_timer_get_time() / 1000, (int64_t) 1)));
+    out.println();
+    ui_jobs.report_power(out, "ui");
+    sensor_jobs.report_power(out, "sensor");
+    network_jobs.report_power(out, "network");
+    unsigned long published = first_publish_at;
+    out.printf("boot: first reading after %lu ms, WiFi after %lu ms (%s), first publish after %lu ms (%lu after WiFi)\n",
+        first_reading_at.load(), wifi_connected_at, !wifi_connected_at ? "none" : wifi_fast ? "cached" : "full",
+        published, published ? published - wifi_connected_at : 0);
+}
+
+void report() {
+    print_report(Serial);
+}
 
-    if (ota_enabled) ArduinoOTA.handle();
-    check_buttons();
+// The report outgrows one MQTT message with every feature enabled, so it is
+// published as several of whole lines each
+void publish_report() {
+    if (!mqtt.connected()) return;
+    static OperameStats::Messages<1536> messages([](const char* data, size_t length) {
+        mqtt.publish(mqtt_stats_topic.c_str(), data, length, false, 0);
+    });
+    print_report(messages);
+    messages.finish();
+}
+
+void render() {
+    // Blank while a button is held, as feedback that it registers
+    if (buttons.held_for(pin_portalbutton) >= buttons.debounce
+     || buttons.held_for(pin_demobutton) >= buttons.debounce) {
+        display_big("");
+        return;
+    }
+
+    Reading reading;
+    co2_reading.read(reading);
+    int co2 = reading.co2;
+    if (co2 < 0) {
+        display_big(T->error_sensor, TFT_RED);
+    } else if (co2 == 0) {
+        display_big(T->wait);
+    } else if (graph_shown) {
+        display_graph(co2);
+    } else {
+        // some MH-Z19's go to 10000 but the display has space for 4 digits
+        display_ppm(co2 > 9999 ? 9999 : co2);
+    }
+}
+
+void IRAM_ATTR wake_ui() {
+    ui_jobs.wake();
+}
+
+// Without automatic light sleep, the UI task puts the chip in light sleep by
+// itself while neither it nor the sensor task has a job due for a while
+bool nap() {
+    if (!buttons.idle()) return false;  // long presses need polling
+    pusher.flush();
+    unsigned long ms = std::min(ui_jobs.idle_time(), sensor_jobs.sleeping_for());
+    if (ms < OperamePower::min_nap) return false;
+
+    int64_t start = esp_timer_get_time();
+    OperamePower::nap(ms);
+    int64_t us = esp_timer_get_time() - start;
+    napped_us += us;
+    ui_jobs.slept(us);
+    sensor_jobs.wake();
+    return true;
+}
+
+void loop() {
+    ui_jobs.run();
+    if (power_mode == OperamePower::NAPS && nap()) return;
+    if (ui_jobs.wait()) {
+        // A button changed; handle it now instead of at the next poll
+        ui_jobs.resume(buttons_job);
+        ui_jobs.resume(render_job);
+    }
 }
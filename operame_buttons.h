@@ -0,0 +1,174 @@
+#include <Arduino.h>
+#include <atomic>
+#ifdef ESP32
+#include <driver/gpio.h>
+#include <hal/gpio_ll.h>
+#endif
+
+namespace OperameButtons {
+
+enum Type { PRESS, LONG_PRESS };
+
+struct Event {
+    int     pin;
+    Type    type;
+};
+
+// Active-low push buttons read through GPIO edge interrupts. The interrupt
+// handler only timestamps the edge into a lock-free queue; debouncing and
+// classification happen in the task that calls next(), so nothing ever
+// waits for a button to be released.
+//
+// Every press yields exactly one event: LONG_PRESS as soon as the button has
+// been held for long_press ms, otherwise PRESS on release. Contact bounce
+// shorter than `debounce` ms is ignored.
+class Buttons {
+  public:
+    static const int max_buttons = 4;
+    static const unsigned long debounce   = 50;
+    static const unsigned long long_press = 2000;
+
+    void add(int pin) {
+        if (count == max_buttons) return;
+        Button& b = buttons[count];
+        b.owner = this;
+        b.index = count++;
+        b.pin = pin;
+        attachInterruptArg(digitalPinToInterrupt(pin), isr, &b, CHANGE);
+    }
+
+    // Lets the buttons wake the ESP32 from light sleep, which only level
+    // triggers can. Their interrupts become level-triggered, and each one
+    // re-arms its pin for the opposite level, so that there is still one
+    // interrupt per edge and a held button does not keep firing. Call after
+    // add().
+    void wake_from_sleep() {
+#ifdef ESP32
+        levels = true;
+        for (int i = 0; i < count; i++) {
+            gpio_num_t pin = (gpio_num_t) buttons[i].pin;
+            gpio_wakeup_enable(pin, digitalRead(pin) == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+        }
+#endif
+    }
+
+    bool next(Event& event) {
+        update();
+        if (events_head == events_tail) return false;
+        event = events[events_tail++ % queue_size];
+        return true;
+    }
+
+    // How long the button has been held down so far, 0 if it is up
+    unsigned long held_for(int pin) {
+        update();
+        for (int i = 0; i < count; i++) {
+            if (buttons[i].pin == pin && buttons[i].down) return millis() - buttons[i].since;
+        }
+        return 0;
+    }
+
+    // True when no button is down and no event is pending, so that until
+    // the next edge there is nothing to poll for
+    bool idle() {
+        update();
+        for (int i = 0; i < count; i++) if (buttons[i].down) return false;
+        return events_head == events_tail;
+    }
+
+    // Called from the interrupt handler after every edge, e.g. to wake the
+    // task that calls next(); must be in IRAM
+    void (*on_edge)() = nullptr;
+
+    // Drops pending events, e.g. for a press that was already acted upon
+    void clear() {
+        update();
+        events_tail = events_head;
+    }
+
+  private:
+    static const int queue_size = 16;
+
+    struct Button {
+        Buttons*        owner;
+        int             index;
+        int             pin;
+        bool            down;
+        bool            long_sent;
+        unsigned long   since;
+    };
+
+    struct Edge {
+        uint8_t         index;
+        uint8_t         level;
+        unsigned long   time;
+    };
+
+    static void IRAM_ATTR isr(void* arg) {
+        Button* b = (Button*) arg;
+        uint8_t level = digitalRead(b->pin);
+#ifdef ESP32
+        // A level that changed again since is caught by the trigger at once
+        if (b->owner->levels) gpio_ll_set_intr_type(&GPIO, b->pin, level == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+#endif
+        b->owner->push_edge({ (uint8_t) b->index, level, millis() });
+        if (b->owner->on_edge) b->owner->on_edge();
+    }
+
+    void IRAM_ATTR push_edge(const Edge& edge) {
+        unsigned int head = edges_head.load(std::memory_order_relaxed);
+        if (head - edges_tail.load(std::memory_order_acquire) == queue_size) return;  // full
+        edges[head % queue_size] = edge;
+        edges_head.store(head + 1, std::memory_order_release);
+    }
+
+    void push_event(int pin, Type type) {
+        if (events_head - events_tail == queue_size) events_tail++;  // drop oldest
+        events[events_head++ % queue_size] = { pin, type };
+    }
+
+    void update() {
+        unsigned int tail = edges_tail.load(std::memory_order_relaxed);
+        while (tail != edges_head.load(std::memory_order_acquire)) {
+            Edge edge = edges[tail % queue_size];
+            edges_tail.store(++tail, std::memory_order_release);
+
+            Button& b = buttons[edge.index];
+            if (edge.level == LOW) {
+                if (!b.down) {
+                    b.down = true;
+                    b.long_sent = false;
+                    b.since = edge.time;
+                }
+            } else if (b.down) {
+                b.down = false;
+                if (!b.long_sent && edge.time - b.since >= debounce) push_event(b.pin, PRESS);
+            }
+        }
+
+        unsigned long now = millis();
+        for (int i = 0; i < count; i++) {
+            Button& b = buttons[i];
+            if (!b.down) continue;
+            if (digitalRead(b.pin) == HIGH && now - b.since >= debounce) {
+                b.down = false;  // missed the release edge
+                if (!b.long_sent) push_event(b.pin, PRESS);
+            } else if (!b.long_sent && now - b.since >= long_press) {
+                b.long_sent = true;
+                push_event(b.pin, LONG_PRESS);
+            }
+        }
+    }
+
+    Button                      buttons[max_buttons] = {};
+    int                         count = 0;
+    volatile bool               levels = false;     // level instead of edge interrupts
+    Edge                        edges[queue_size];
+    std::atomic<unsigned int>   edges_head { 0 };
+    std::atomic<unsigned int>   edges_tail { 0 };
+    Event                       events[queue_size];
+    unsigned int                events_head = 0;
+    unsigned int                events_tail = 0;
+};
+
+} // namespace
@@ -0,0 +1,117 @@
+#include <Arduino.h>
+
+namespace OperameCapture {
+
+// Trace of the bytes exchanged with a serial device, one line per burst:
+//
+//   uart 1520 > ff0185000000000079
+//   uart 1531 < ff85000001b8000000c2
+//
+// milliseconds since boot, direction (> sent, < received) and the bytes in
+// hex. Sent bytes are one burst per write(), as drivers send a command at
+// once; a received burst ends after a pause of `gap` ms or at `max_burst`
+// bytes. Received bytes are stamped when the driver reads them, which is at
+// most one poll interval after they arrived.
+const unsigned long gap       = 5;
+const size_t        max_burst = 32;
+
+// Sits between a driver and its serial port, passing everything through and,
+// while recording, writing the trace to another stream. Lines are assembled in
+// RAM and written whole, so the driver's timing hardly changes.
+class Recorder : public Stream {
+  public:
+    explicit Recorder(Stream& serial) : serial(serial) { }
+
+    // Stops by itself after `limit` bytes of trace, if given, so that a file
+    // cannot fill the flash.
+    void start(Stream& out, size_t limit = 0) {
+        this->out = &out;
+        this->limit = limit;
+        written = 0;
+        length = 0;
+    }
+
+    void stop() {
+        end();
+        out = nullptr;
+    }
+
+    bool recording() const { return out; }
+
+    // Writes out a burst that has ended by pausing; call now and then
+    void poll() {
+        if (length && millis() - last > gap) end();
+        if (out && dirty) out->flush();
+        dirty = false;
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override {
+        end();
+        note('>', buf, size);
+        end();
+        return serial.write(buf, size);
+    }
+
+    int read() override {
+        int c = serial.read();
+        if (c >= 0) {
+            uint8_t b = c;
+            note('<', &b, 1);
+        }
+        return c;
+    }
+
+    int available() override { return serial.available(); }
+    int peek() override { return serial.peek(); }
+    void flush() override { serial.flush(); }
+
+  private:
+    void note(char direction, const uint8_t* buf, size_t size) {
+        if (!out) return;
+        unsigned long now = millis();
+        for (size_t i = 0; i < size; i++) {
+            if (length && (direction != this->direction || now - last > gap || length == max_burst)) end();
+            if (!length) {
+                this->direction = direction;
+                first = now;
+            }
+            bytes[length++] = buf[i];
+            last = now;
+        }
+    }
+
+    void end() {
+        if (!out || !length) return;
+
+        char line[32 + 2 * max_burst];
+        int n = snprintf(line, sizeof(line), "uart %lu %c ", first, direction);
+        for (size_t i = 0; i < length; i++) n += snprintf(line + n, sizeof(line) - n, "%02x", bytes[i]);
+        line[n++] = '\n';
+        length = 0;
+
+        if (limit && written + n > limit) {
+            out = nullptr;
+            return;
+        }
+        out->write((const uint8_t*) line, n);
+        written += n;
+        dirty = true;
+    }
+
+    Stream&         serial;
+    Stream*         out = nullptr;
+    size_t          limit = 0;
+    size_t          written = 0;
+    bool            dirty = false;
+
+    // The burst being assembled
+    char            direction = 0;
+    unsigned long   first = 0;
+    unsigned long   last = 0;
+    uint8_t         bytes[max_burst];
+    size_t          length = 0;
+};
+
+} // namespace
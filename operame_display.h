@@ -0,0 +1,162 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <mutex>
+#include <condition_variable>
+
+namespace OperameDisplay {
+
+// Sends a 4-bit palette sprite to the display from a task of its own, with
+// SPI DMA where the display supports it. push() only hands over the region
+// and returns; the task expands the sprite band by band into two RGB565
+// buffers, filling one while DMA transmits the other. Without a task, push()
+// sends the region itself.
+//
+// Until every band has been expanded the sprite is still being read, so
+// fence() must be called before drawing into it again, and flush() before
+// drawing on the display directly. Time spent waiting there is the cost
+// that is left of pushing a frame, and is kept as a statistic.
+class Pusher {
+  public:
+    static const int band_pixels = 1920;  // 8 rows of 240 pixels, 3840 bytes per buffer
+
+    // With `task`, run() must be called in a loop on a task of its own
+    void begin(TFT_eSPI& tft, TFT_eSprite& sprite, const uint16_t* palette, int colors, bool task) {
+        this->tft = &tft;
+        this->sprite = &sprite;
+        this->task = task;
+        for (int i = 0; i < 16; i++) {
+            uint16_t c = i < colors ? palette[i] : 0;
+            colors565[i] = c >> 8 | c << 8;  // sent as is, most significant byte first
+        }
+        tft.setSwapBytes(false);
+        dma = tft.initDMA();
+    }
+
+    // Starts sending the region; waits only for a previous push to clear
+    // the sprite.
+    void push(int x, int y, int w, int h) {
+        int x2 = std::min(x + w, (int) sprite->width()), y2 = std::min(y + h, (int) sprite->height());
+        x = std::max(x, 0);
+        y = std::max(y, 0);
+        if (x2 <= x || y2 <= y) return;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        wait(lock, [this] { return !reading; });
+        region_x = x;
+        region_y = y;
+        region_w = x2 - x;
+        region_h = y2 - y;
+        reading = true;
+        frames++;
+        if (task) {
+            changed.notify_all();
+            return;
+        }
+        lock.unlock();
+        send();
+    }
+
+    void push() { push(0, 0, sprite->width(), sprite->height()); }
+
+    // Returns once the sprite may be drawn into
+    void fence() {
+        std::unique_lock<std::mutex> lock(mutex);
+        wait(lock, [this] { return !reading; });
+    }
+
+    // Returns once the display may be drawn on
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        wait(lock, [this] { return sent == frames; });
+    }
+
+    // Body of the display task: sends one pushed region, or waits for one
+    void run() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return reading; });
+        }
+        send();
+    }
+
+    void report(Print& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        out.printf("display: %lu frames via %s, waited avg %lu max %lu us\n",
+            frames, dma ? "DMA" : "SPI", wait_total / std::max(frames, 1UL), wait_max);
+    }
+
+  private:
+    void send() {
+        std::unique_lock<std::mutex> lock(mutex);
+        int x = region_x, y = region_y, w = region_w, h = region_h;
+        unsigned long frame = frames;
+        lock.unlock();
+
+        int rows = std::max(band_pixels / w, 1);
+        int buffer = 0;
+        tft->startWrite();
+        for (int row = y; row < y + h; row += rows) {
+            int n = std::min(rows, y + h - row);
+            expand(buffers[buffer], x, row, w, n);
+            if (row + n == y + h) {
+                std::lock_guard<std::mutex> lock(mutex);
+                reading = false;
+                changed.notify_all();
+            }
+
+            // The other buffer may still be in flight; pushImageDMA() waits
+            // for it before starting this one.
+            if (dma) tft->pushImageDMA(x, row, w, n, buffers[buffer]);
+            else     tft->pushImage(x, row, w, n, buffers[buffer]);
+            buffer ^= 1;
+        }
+        if (dma) tft->dmaWait();
+        tft->endWrite();
+
+        lock.lock();
+        sent = frame;
+        changed.notify_all();
+    }
+
+    template <typename Predicate>
+    void wait(std::unique_lock<std::mutex>& lock, Predicate ready) {
+        if (ready()) return;
+        unsigned long start = micros();
+        changed.wait(lock, ready);
+        unsigned long waited = micros() - start;
+        wait_total += waited;
+        wait_max = std::max(wait_max, waited);
+    }
+
+    // Palette indexes to RGB565; at 4 bpp the even pixel is the high nibble
+    void expand(uint16_t* out, int x, int y, int w, int h) {
+        const uint8_t* img = (const uint8_t*) sprite->getPointer();
+        int stride = (sprite->width() + 1) / 2;
+        for (int j = y; j < y + h; j++) {
+            const uint8_t* in = img + j * stride;
+            for (int i = x; i < x + w; i++) {
+                uint8_t pair = in[i / 2];
+                *out++ = colors565[i & 1 ? pair & 0x0f : pair >> 4];
+            }
+        }
+    }
+
+    TFT_eSPI*               tft = nullptr;
+    TFT_eSprite*            sprite = nullptr;
+    bool                    task = false;
+    bool                    dma = false;
+    uint16_t                colors565[16];
+    uint16_t                buffers[2][band_pixels];
+
+    std::mutex              mutex;
+    std::condition_variable changed;
+    bool                    reading = false;  // bands left to expand from the sprite
+    int                     region_x, region_y, region_w, region_h;
+
+    unsigned long           frames = 0;       // pushed
+    unsigned long           sent = 0;         // frames of which the transfer finished
+    unsigned long           wait_total = 0;   // us
+    unsigned long           wait_max = 0;     // us
+};
+
+} // namespace
@@ -0,0 +1,120 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+namespace OperameGlyphs {
+
+// The digits 0-9 of one font, rasterised once into 1-bit masks. Drawing a
+// number into a 4-bit sprite then takes a table lookup per eight pixels
+// instead of decoding the font for every frame, and works for any colour
+// pair. A mask covers the whole character cell, background included, so
+// the result is identical to drawString() with a background colour.
+class Atlas {
+  public:
+    static const int max_width  = 64;   // one mask row per uint64_t
+    static const int max_height = 80;
+
+    // Renders the digits in the top left corner of the sprite, which must be
+    // cleared afterwards.
+    bool build(TFT_eSprite& sprite, uint8_t font) {
+        ready = false;
+        if (sprite.getColorDepth() != 4) return false;
+
+        sprite.setTextFont(font);
+        sprite.setTextSize(1);
+        sprite.setTextDatum(TL_DATUM);
+        sprite.setTextColor(1, 0);
+        width  = sprite.textWidth("0");
+        height = sprite.fontHeight();
+        if (width > max_width || height > max_height) return false;
+        if (width > sprite.width() || height > sprite.height()) return false;
+
+        const uint8_t* img = (const uint8_t*) sprite.getPointer();
+        int stride = (sprite.width() + 1) / 2;
+        for (int digit = 0; digit < 10; digit++) {
+            char text[2] = { (char) ('0' + digit), 0 };
+            if (sprite.textWidth(text) != width) return false;
+            sprite.fillRect(0, 0, width, height, 0);
+            sprite.drawString(text, 0, 0);
+
+            for (int y = 0; y < height; y++) {
+                uint64_t bits = 0;
+                for (int x = 0; x < width; x++) {
+                    uint8_t pair = img[y * stride + x / 2];
+                    if ((x & 1 ? pair & 0x0f : pair >> 4) == 1) bits |= 1ULL << (63 - x);
+                }
+                masks[digit][y] = bits;
+            }
+        }
+        this->font = font;
+        ready = true;
+        return true;
+    }
+
+    bool built(uint8_t font) const { return ready && font == this->font; }
+
+    // Draws a string of digits centered on (x, y), as drawString() does with
+    // MC_DATUM. Returns false, without drawing, for anything it cannot draw.
+    bool draw(TFT_eSprite& sprite, const char* text, int x, int y, uint8_t fg, uint8_t bg) const {
+        const int max_digits = 5;
+        int n = strlen(text);
+        if (!ready || !n || n > max_digits) return false;
+        for (int i = 0; i < n; i++) if (text[i] < '0' || text[i] > '9') return false;
+
+        int total = n * width;
+        int x1 = x - total / 2, y1 = y - height / 2;
+        if (x1 < 0 || y1 < 0 || x1 + total > sprite.width() || y1 + height > sprite.height()) return false;
+
+        uint8_t pairs[4] = {
+            (uint8_t) (bg << 4 | bg), (uint8_t) (bg << 4 | fg),
+            (uint8_t) (fg << 4 | bg), (uint8_t) (fg << 4 | fg)
+        };
+        if (pairs[1] != colors) {
+            colors = pairs[1];
+            for (int i = 0; i < 256; i++) {
+                uint8_t out[4] = { pairs[i >> 6], pairs[i >> 4 & 3], pairs[i >> 2 & 3], pairs[i & 3] };
+                memcpy(&bytes[i], out, 4);
+            }
+        }
+
+        uint8_t* img = (uint8_t*) sprite.getPointer();
+        int stride = (sprite.width() + 1) / 2;
+        int offset = x1 & 1;            // an odd start shares its byte with the left neighbour
+        int bits = offset + total;
+
+        for (int row = 0; row < height; row++) {
+            // Line up the mask rows of all digits, starting at an even pixel
+            uint64_t line[(max_digits * max_width + 1 + 63) / 64] = {};
+            for (int i = 0; i < n; i++) {
+                uint64_t mask = masks[text[i] - '0'][row];
+                int p = offset + i * width;
+                line[p / 64] |= mask >> (p % 64);
+                if (p % 64) line[p / 64 + 1] |= mask << (64 - p % 64);
+            }
+
+            uint8_t* out = img + (y1 + row) * stride + x1 / 2;
+            uint8_t first = out[0], last = out[(bits - 1) / 2];
+            int b = 0;
+            for (; b + 8 <= bits; b += 8, out += 4) memcpy(out, &bytes[(line[b / 64] >> (56 - b % 64)) & 0xff], 4);
+            for (; b < bits; b += 2) *out++ = pairs[(line[b / 64] >> (62 - b % 64)) & 3];
+
+            // Restore the neighbouring pixels that share the outer bytes
+            out = img + (y1 + row) * stride + x1 / 2;
+            if (offset)   out[0] = (first & 0xf0) | (out[0] & 0x0f);
+            if (bits & 1) out[(bits - 1) / 2] = (out[(bits - 1) / 2] & 0xf0) | (last & 0x0f);
+        }
+        return true;
+    }
+
+  private:
+    bool        ready = false;
+    uint8_t     font = 0;
+    int         width = 0;
+    int         height = 0;
+    uint64_t    masks[10][max_height];
+
+    // Eight mask bits to the four sprite bytes they become, for one colour pair
+    mutable uint32_t    bytes[256];
+    mutable int         colors = -1;    // bg << 4 | fg of the table
+};
+
+} // namespace
@@ -0,0 +1,284 @@
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+namespace OperameHistory {
+
+// On-flash CO2 log: a ring of fixed-size block files, /history-0 and so on.
+// Each block starts with a header holding the first sample; every further
+// sample is one varint record, usually a single byte:
+//
+//   (zigzag(ppm - previous ppm) << 1) | 0     next sample on the grid
+//   ((number of missed samples) << 1) | 1     gap, e.g. read errors
+//
+// Samples are buffered in RAM and appended a flash page at a time, or at
+// least every max_delay seconds, which bounds both the number of writes and
+// what a power cut can lose. SPIFFS levels wear within the partition; the
+// ring keeps the log itself from growing.
+
+struct Header {
+    uint32_t    magic;
+    uint32_t    sequence;   // one higher than the previous block
+    uint32_t    start;      // uptime in seconds of the first sample
+    uint16_t    interval;   // seconds between samples
+    uint16_t    first;      // ppm of the first sample
+};
+
+const uint32_t      magic       = 0x314c4f43;  // "COL1"
+const size_t        block_size  = 4096;
+const int           blocks      = 96;          // 384 kB, three weeks of 5 s samples
+const size_t        page        = 256;
+const unsigned long max_delay   = 15 * 60;
+
+inline String path(int block) {
+    return "/history-" + String(block);
+}
+
+// A point in the log: a boot, by the sequence number of its first block, and
+// the uptime in seconds in that boot
+struct Mark {
+    uint32_t    magic;
+    uint32_t    boot;
+    uint32_t    seconds;
+};
+
+class Log {
+  public:
+    // Continues the ring after the block last written; new samples always
+    // start a new block because the uptime clock restarted.
+    void begin(unsigned int interval) {
+        this->interval = interval;
+        Head head;
+        File f = SPIFFS.open("/history-head", FILE_READ);
+        if (f && f.read((uint8_t*) &head, sizeof(head)) == sizeof(head) && head.magic == magic) {
+            block = head.block % blocks;
+            sequence = head.sequence;
+        }
+        boot = sequence + 1;
+    }
+
+    // Sequence number of the first block of this boot; fixed by begin(), so
+    // safe to read from any task
+    uint32_t first_sequence() const { return boot; }
+
+    void add(uint32_t seconds, int co2) {
+        if (co2 <= 0) return;
+
+        uint8_t record[10];
+        size_t n = 0;
+        if (started) {
+            uint32_t slots = (seconds - last + interval / 2) / interval;
+            if (slots == 0) return;  // early duplicate
+            if (slots > 1) n += varint(record + n, (slots - 1) << 1 | 1);
+            n += varint(record + n, zigzag(co2 - previous) << 1);
+            last += slots * interval;
+        }
+        if (!started || used + length + n > block_size) {
+            start(seconds, co2);
+            return;
+        }
+
+        if (!length) buffered_since = seconds;
+        memcpy(buffer + length, record, n);
+        length += n;
+        previous = co2;
+        if (length >= page) flush();
+    }
+
+    // Call regularly; writes out samples that have waited too long
+    void poll(uint32_t seconds) {
+        if (length && seconds - buffered_since >= max_delay) flush();
+    }
+
+    void flush() {
+        if (!length) return;
+        File f = SPIFFS.open(path(block), FILE_APPEND);
+        if (f) f.write(buffer, length);
+        used += length;
+        length = 0;
+    }
+
+    // Bytes written to flash so far plus those still buffered
+    size_t bytes() const { return total + used + length; }
+
+  private:
+    struct Head {
+        uint32_t    magic;
+        uint32_t    sequence;
+        uint32_t    block;
+    };
+
+    void start(uint32_t seconds, int co2) {
+        flush();
+        if (started) total += used;
+
+        block = (block + 1) % blocks;
+        header = { magic, ++sequence, seconds, (uint16_t) interval, (uint16_t) co2 };
+        SPIFFS.remove(path(block));
+        memcpy(buffer, &header, sizeof(header));
+        length = sizeof(header);
+        used = 0;
+        buffered_since = seconds;
+
+        // Remember where the ring is
+        Head head = { magic, sequence, (uint32_t) block };
+        File f = SPIFFS.open("/history-head", FILE_WRITE);
+        if (f) f.write((const uint8_t*) &head, sizeof(head));
+
+        started  = true;
+        last     = seconds;
+        previous = co2;
+    }
+
+    static uint32_t zigzag(int32_t v) {
+        return (uint32_t) (v << 1) ^ (uint32_t) (v >> 31);
+    }
+
+    static size_t varint(uint8_t* out, uint32_t v) {
+        size_t n = 0;
+        while (v >= 0x80) {
+            out[n++] = v | 0x80;
+            v >>= 7;
+        }
+        out[n++] = v;
+        return n;
+    }
+
+    Header          header = {};
+    unsigned int    interval = 5;
+    int             block = blocks - 1;
+    uint32_t        sequence = 0;
+    uint32_t        boot = 1;
+    bool            started = false;
+    uint32_t        last = 0;           // grid time of the previous sample
+    int             previous = 0;       // ppm of the previous sample
+    uint8_t         buffer[page + 16];  // room for one record past a page
+    size_t          length = 0;
+    size_t          used = 0;           // bytes of the current block on flash
+    size_t          total = 0;
+    uint32_t        buffered_since = 0;
+};
+
+// Decodes one block of the log
+class Reader {
+  public:
+    bool open(int block) {
+        f = SPIFFS.open(path(block), FILE_READ);
+        if (!f || f.read((uint8_t*) &header, sizeof(header)) != sizeof(header)) return false;
+        if (header.magic != magic) return false;
+        first = true;
+        return true;
+    }
+
+    const Header& info() const { return header; }
+
+    // Next sample, with its uptime in seconds
+    bool next(uint32_t& seconds, int& co2) {
+        if (first) {
+            first = false;
+            time = header.start;
+            ppm = header.first;
+        } else {
+            uint32_t v;
+            if (!varint(v)) return false;
+            if (v & 1) {
+                time += (v >> 1) * header.interval;
+                if (!varint(v)) return false;
+            }
+            v >>= 1;
+            ppm += (int32_t) (v >> 1) ^ -(int32_t) (v & 1);
+            time += header.interval;
+        }
+        seconds = time;
+        co2 = ppm;
+        return true;
+    }
+
+  private:
+    bool varint(uint32_t& v) {
+        v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            int c = f.read();
+            if (c < 0) return false;
+            v |= (uint32_t) (c & 0x7f) << shift;
+            if (!(c & 0x80)) return true;
+        }
+        return false;
+    }
+
+    File        f;
+    Header      header;
+    bool        first;
+    uint32_t    time;
+    int         ppm;
+};
+
+// Remembers a Mark across reboots in /history-mark, e.g. where readings
+// started to go unpublished. Writes to flash, so meant for rare events
+// rather than every reading.
+inline void set_mark(uint32_t boot, uint32_t seconds) {
+    Mark mark = { magic, boot, seconds };
+    File f = SPIFFS.open("/history-mark", FILE_WRITE);
+    if (f) f.write((const uint8_t*) &mark, sizeof(mark));
+}
+
+inline void clear_mark() {
+    SPIFFS.remove("/history-mark");
+}
+
+inline bool get_mark(Mark& mark) {
+    File f = SPIFFS.open("/history-mark", FILE_READ);
+    return f && f.read((uint8_t*) &mark, sizeof(mark)) == sizeof(mark) && mark.magic == magic;
+}
+
+// Walks the samples of the boots from mark.boot up to, not including, `boot`,
+// starting at the mark, on one clock that continues across reboots like the
+// rollups' does: the first sample after a reboot follows the last one before
+// it by one interval. Calls fn(seconds, co2) and returns the seconds of the
+// last sample, or 0 if there was none.
+template <typename F>
+uint32_t walk(const Mark& mark, uint32_t boot, F fn) {
+    struct { uint32_t sequence; int block; } order[blocks];
+    int n = 0;
+    for (int b = 0; b < blocks; b++) {
+        Reader r;
+        if (!r.open(b) || r.info().sequence - mark.boot >= boot - mark.boot) continue;
+        int i = n++;
+        for (; i && order[i - 1].sequence > r.info().sequence; i--) order[i] = order[i - 1];
+        order[i] = { r.info().sequence, b };
+    }
+
+    // Samples before the mark are skipped, unless its boot has been overwritten
+    bool marked_boot = n && order[0].sequence == mark.boot;
+    uint32_t offset = 0, previous = 0, last = 0;
+    bool started = false;
+    for (int i = 0; i < n; i++) {
+        Reader r;
+        if (!r.open(order[i].block)) continue;
+        if (started && r.info().start + offset < previous) {
+            // The uptime clock restarted: a new boot
+            offset = previous + r.info().interval - r.info().start;
+            marked_boot = false;
+        }
+        uint32_t seconds;
+        int co2;
+        while (r.next(seconds, co2)) {
+            previous = seconds + offset;
+            started = true;
+            if (marked_boot && seconds < mark.seconds) continue;
+            last = previous;
+            fn(last, co2);
+        }
+    }
+    return last;
+}
+
+// Samples from earlier boots since the mark, oldest first, as fn(ago, co2)
+// with `ago` the seconds before the last of them. How long the unit was off
+// is not known, so that time is left out.
+template <typename F>
+void since(const Mark& mark, uint32_t boot, F fn) {
+    uint32_t last = walk(mark, boot, [](uint32_t, int) { });
+    walk(mark, boot, [&](uint32_t seconds, int co2) { fn(last - seconds, co2); });
+}
+
+} // namespace
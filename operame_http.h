@@ -0,0 +1,167 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <operame_stats.h>
+
+namespace OperameHTTP {
+
+// A document served from RAM. Headers and body are formatted by `render`
+// only after invalidate(), at the next request, and every request until the
+// next invalidate() is answered with the same bytes.
+class Page {
+  public:
+    typedef void (*Render)(Print& out);
+
+    Page(const char* path, const char* type, Render render, char* storage, size_t size)
+        : path(path), type(type), render(render), body(storage, size) { }
+
+    void invalidate() { stale = true; }
+
+    // Times the document was formatted since boot
+    unsigned long renders() const { return rendered; }
+
+    const char* const path;
+
+    void send(Client& client) {
+        if (stale) {
+            body.length = 0;
+            render(body);
+            rendered++;
+            head.clear();
+            head.printf("HTTP/1.0 200 OK\r\nContent-Type: %s\r\nContent-Length: %u\r\nConnection: close\r\n\r\n",
+                type, (unsigned) body.length);
+            stale = false;
+        }
+        client.write((const uint8_t*) head.c_str(), head.length);
+        client.write((const uint8_t*) body.data, body.length);
+    }
+
+  private:
+    // Like OperameStats::Buffer, on storage of the size the Document chose
+    struct Body : public Print {
+        Body(char* data, size_t size) : data(data), size(size) { }
+        size_t write(uint8_t c) override {
+            if (length == size) return 0;
+            data[length++] = c;
+            return 1;
+        }
+        char*   data;
+        size_t  size;
+        size_t  length = 0;
+    };
+
+    const char*                 type;
+    Render                      render;
+    Body                        body;
+    OperameStats::Buffer<128>   head;
+    bool                        stale = true;
+    unsigned long               rendered = 0;
+};
+
+// A page with room for `size` bytes of body; what does not fit is cut off
+template <size_t size>
+class Document : public Page {
+  public:
+    Document(const char* path, const char* type, Render render) : Page(path, type, render, storage, size) { }
+
+  private:
+    char    storage[size];
+};
+
+// HTTP/1.0 for a few fixed pages, for polling by monitoring systems. poll()
+// never waits: it accepts what is pending, reads requests as far as they
+// have arrived, and answers those that are complete. Every response fits
+// in the socket's send buffer, so writing it does not wait either.
+class Server {
+  public:
+    static const int            max_clients = 4;
+    static const int            max_pages   = 4;
+    static const unsigned long  timeout     = 2000;  // ms for a request line
+
+    explicit Server(uint16_t port) : server(port) { }
+
+    void add(Page& page) {
+        if (count < max_pages) pages[count++] = &page;
+    }
+
+    void begin() {
+        server.begin();
+        server.setNoDelay(true);
+    }
+
+    void poll() {
+        for (Connection& c : connections) {
+            if (!c.client) c = { server.available(), "", 0, 0, false, millis() };
+            if (!c.client) continue;
+            if (receive(c)) {
+                OperameStats::Timer timer(serve_time);
+                answer(c);
+            } else if (millis() - c.since < timeout) {
+                continue;
+            }
+            c.client.stop();
+        }
+    }
+
+    void report(Print& out) const {
+        out.printf("%-10s %8lu runs, ", "requests", (unsigned long) serve_time.count());
+        serve_time.report(out);
+        out.println();
+    }
+
+  private:
+    struct Connection {
+        WiFiClient      client;
+        char            line[64];   // the request line
+        size_t          length;
+        int             lines;      // complete lines received
+        bool            at_start;   // nothing yet of the current line
+        unsigned long   since;
+    };
+
+    // True once the headers have ended with a blank line. Only the request
+    // line is kept, cut short if it does not fit.
+    static bool receive(Connection& c) {
+        while (c.client.available()) {
+            char ch = c.client.read();
+            if (ch == '\r') continue;
+            if (ch == '\n') {
+                if (c.lines++ && c.at_start) return true;
+                c.at_start = true;
+                continue;
+            }
+            if (!c.lines && c.length < sizeof(c.line) - 1) c.line[c.length++] = ch;
+            c.at_start = false;
+        }
+        return false;
+    }
+
+    void answer(Connection& c) {
+        // "GET /metrics HTTP/1.1"; the query and the headers are ignored
+        c.line[c.length] = '\0';
+        char* path = strchr(c.line, ' ');
+        if (path) path++;
+        if (path) path[strcspn(path, " ?")] = '\0';
+
+        Page* page = nullptr;
+        for (int i = 0; path && i < count; i++) {
+            if (!strcmp(pages[i]->path, path)) page = pages[i];
+        }
+        if (strncmp(c.line, "GET ", 4)) page = nullptr;
+
+        if (page) {
+            page->send(c.client);
+        } else {
+            static const char not_found[] =
+                "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            c.client.write((const uint8_t*) not_found, sizeof(not_found) - 1);
+        }
+    }
+
+    WiFiServer                  server;
+    Page*                       pages[max_pages];
+    int                         count = 0;
+    Connection                  connections[max_clients];
+    OperameStats::Histogram     serve_time;
+};
+
+} // namespace
@@ -0,0 +1,38 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+namespace OperameImage {
+
+// Run-length encoded image with a palette of RGB565 colours, as generated by
+// logo.py. Each run is a word: palette index << 7 | (length - 1). Runs wrap
+// from one row to the next.
+struct Image {
+    uint16_t        width;
+    uint16_t        height;
+    const uint16_t* palette;
+    const uint16_t* runs;
+    size_t          count;
+};
+
+// Decodes the runs straight into a sprite or the display as horizontal lines;
+// there is no intermediate pixel buffer.
+inline void draw(TFT_eSPI& tft, int32_t x, int32_t y, const Image& image) {
+    int32_t column = 0, row = 0;
+    for (size_t i = 0; i < image.count && row < image.height; i++) {
+        uint16_t run = pgm_read_word(&image.runs[i]);
+        uint16_t color = pgm_read_word(&image.palette[run >> 7]);
+        int32_t length = (run & 0x7f) + 1;
+        while (length && row < image.height) {
+            int32_t n = std::min(length, image.width - column);
+            tft.drawFastHLine(x + column, y + row, n, color);
+            length -= n;
+            column += n;
+            if (column == image.width) {
+                column = 0;
+                row++;
+            }
+        }
+    }
+}
+
+} // namespace
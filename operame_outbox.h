@@ -0,0 +1,38 @@
+#include <Arduino.h>
+
+namespace OperameOutbox {
+
+struct Entry {
+    int32_t     time;   // uptime in seconds; before a restart, negative
+    int32_t     co2;
+};
+
+// Readings that could not be published yet, oldest first. When full, the
+// oldest reading makes way for the newest. Fixed size, no allocations.
+template <size_t capacity>
+class Outbox {
+  public:
+    void push(int32_t time, int co2) {
+        if (count == capacity) pop(1);
+        entries[(first + count++) % capacity] = { time, co2 };
+    }
+
+    // i = 0 is the oldest
+    const Entry& at(size_t i) const { return entries[(first + i) % capacity]; }
+
+    void pop(size_t n) {
+        n = std::min(n, count);
+        first = (first + n) % capacity;
+        count -= n;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+  private:
+    Entry   entries[capacity];
+    size_t  first = 0;
+    size_t  count = 0;
+};
+
+} // namespace
@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#ifdef ESP32
+#include <esp_wifi.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#endif
+
+namespace OperamePower {
+
+enum Mode { NONE, MODEM_SLEEP, LIGHT_SLEEP, NAPS };
+
+inline const char* name(Mode mode) {
+    return mode == LIGHT_SLEEP ? "light sleep" : mode == MODEM_SLEEP ? "modem sleep" : mode == NAPS ? "light sleep naps" : "none";
+}
+
+// Shortest idle time worth a nap; waking takes about a millisecond
+const unsigned long min_nap = 20;
+
+// Lets the ESP32 save power while every task waits for its next job. The
+// radio only wakes for the beacons it must hear, and the CPU drops to 80 MHz
+// when idle. Where the Arduino core was built with power management and
+// tickless idle, the chip also light-sleeps when idle, until the next task
+// is due or a GPIO wake-up source such as the buttons fires (see
+// OperameButtons::Buttons::wake_from_sleep). The stock core is not, so
+// without WiFi the caller is told to nap() instead; with WiFi, which a nap
+// would cut off, this is modem sleep only. Call after WiFi has connected.
+inline Mode begin(bool wifi) {
+#ifdef ESP32
+    esp_sleep_enable_gpio_wakeup();
+    Mode mode = NONE;
+    if (wifi && WiFi.status() == WL_CONNECTED && esp_wifi_set_ps(WIFI_PS_MAX_MODEM) == ESP_OK) mode = MODEM_SLEEP;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t pm = {};
+    pm.max_freq_mhz = getCpuFrequencyMhz();
+    pm.min_freq_mhz = 80;
+    pm.light_sleep_enable = true;
+    if (esp_pm_configure(&pm) == ESP_OK) return LIGHT_SLEEP;
+    pm.light_sleep_enable = false;
+    esp_pm_configure(&pm);
+#endif
+    return wifi ? mode : NAPS;
+#else
+    return wifi ? NONE : NAPS;
+#endif
+}
+
+// Light sleep for `ms`, or until a GPIO wake-up source fires. Every task and
+// peripheral stops meanwhile, so only for when all tasks wait at least that
+// long and no transfer is in progress. FreeRTOS timeouts need not count the
+// time asleep, so tasks that wait are best woken afterwards.
+inline void nap(unsigned long ms) {
+#ifdef ESP32
+    esp_sleep_enable_timer_wakeup(ms * 1000ULL);
+    esp_light_sleep_start();
+#else
+    delay(ms);
+#endif
+}
+
+} // namespace
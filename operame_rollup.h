@@ -0,0 +1,184 @@
+#include <Arduino.h>
+#include <atomic>
+
+namespace OperameRollup {
+
+// CO2 statistics per minute, hour and day, kept as they come in: every
+// reading updates the current bucket of each resolution in constant time,
+// and a bucket that is complete is never touched again until the ring comes
+// round to it. Meant to live in RTC RAM (RTC_NOINIT_ATTR), which keeps its
+// contents through a soft reset but not through a power cut.
+//
+// Times are seconds on the rollups' own clock, which continues from the last
+// reading after a reset, so a reboot shows up as a short pause rather than
+// as restarted buckets.
+
+struct Bucket {
+    uint32_t    start;
+    uint32_t    sum;        // of ppm
+    uint32_t    count;      // 0 for a bucket that never had a reading
+    uint32_t    warning;    // seconds at or above the warning level
+    uint32_t    critical;   // seconds at or above the critical level
+    uint16_t    min, max;
+
+    int avg() const { return count ? (sum + count / 2) / count : 0; }
+};
+
+// A ring of `size` buckets of `width` seconds each; `head` is the current one.
+// Only add() changes the complete buckets, when it moves on to a new one;
+// `seq` is odd meanwhile, as in OperameTasks::Latest, so that other tasks can
+// read() them.
+template <int size, uint32_t width>
+struct Ring {
+    static const int length = size;
+
+    Bucket                  buckets[size];
+    uint16_t                head;
+    std::atomic<uint32_t>   seq;
+
+    void add(uint32_t now, int co2, uint32_t seconds, int warning, int critical) {
+        uint32_t start = now - now % width;
+        Bucket* b = &buckets[head];
+        if (b->start != start || !b->count) {
+            uint32_t s = seq.load(std::memory_order_relaxed);
+            seq.store(s + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            if (b->count) head = (head + 1) % size;
+            b = &buckets[head];
+            *b = { start, 0, 0, 0, 0, 0xffff, 0 };
+            seq.store(s + 2, std::memory_order_release);
+        }
+        b->sum += co2;
+        b->count++;
+        if (co2 >= warning)  b->warning += seconds;
+        if (co2 >= critical) b->critical += seconds;
+        if (co2 < b->min) b->min = co2;
+        if (co2 > b->max) b->max = co2;
+    }
+
+    // The bucket `ago` before the current one, which need not be `ago` times
+    // `width` earlier: no bucket is started while there are no readings. Only
+    // for the task that calls add().
+    const Bucket& get(int ago) const {
+        return buckets[(head + size - ago % size) % size];
+    }
+
+    // A copy of a complete bucket (`ago` > 0), for any task. Between two calls
+    // the ring may have moved on, so that the same bucket comes back at the
+    // next `ago`; callers that walk the ring skip starts that do not decrease.
+    Bucket read(int ago) const {
+        Bucket b;
+        uint32_t before, after;
+        do {
+            before = seq.load(std::memory_order_acquire);
+            b = get(ago);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = seq.load(std::memory_order_relaxed);
+        } while (before != after || (before & 1));
+        return b;
+    }
+
+    bool valid() const { return head < size; }
+};
+
+const uint32_t magic   = 0x31505552;  // "RUP1"
+const uint32_t max_gap = 60;          // longest pause that counts as time at a level
+
+struct Rollups {
+    uint32_t            magic;
+    uint32_t            last;       // time of the previous reading
+    Ring<60, 60>        minutes;    // the last hour
+    Ring<48, 3600>      hours;      // two days
+    Ring<14, 86400>     days;       // two weeks
+
+    // Keeps what survived a soft reset, or starts over. `uptime` is in
+    // seconds since boot, as later passed to add().
+    void begin(uint32_t uptime) {
+        if (magic != OperameRollup::magic || !minutes.valid() || !hours.valid() || !days.valid()) {
+            memset((void*) this, 0, sizeof(*this));
+            magic = OperameRollup::magic;
+        }
+        // A reset in the middle of add() would leave it odd
+        for (std::atomic<uint32_t>* seq : { &minutes.seq, &hours.seq, &days.seq }) seq->store(0, std::memory_order_relaxed);
+        offset = last - uptime;
+        continued = false;
+    }
+
+    // A reading counts for the time since the one before it, up to max_gap
+    void add(uint32_t uptime, int co2, int warning, int critical) {
+        if (co2 <= 0) return;
+        uint32_t now = uptime + offset;
+        uint32_t seconds = continued ? std::min(now - last, max_gap) : 0;
+        if (co2 > 0xfffe) co2 = 0xfffe;
+
+        minutes.add(now, co2, seconds, warning, critical);
+        hours.add(now, co2, seconds, warning, critical);
+        days.add(now, co2, seconds, warning, critical);
+        last = now;
+        continued = true;
+    }
+
+    // Set anew by begin() at every boot
+    uint32_t            offset;     // from uptime to the rollups' clock
+    bool                continued;  // had a reading since boot
+};
+
+template <typename Ring>
+void report(Print& out, const char* name, const Ring& ring) {
+    // The last complete bucket; the current one is still being written
+    Bucket b = ring.read(1);
+    if (!b.count) return;
+    out.printf("%-10s min %u max %u avg %d, %lu s above warning, %lu s above critical\n",
+        name, b.min, b.max, b.avg(), (unsigned long) b.warning, (unsigned long) b.critical);
+}
+
+inline void report(Print& out, const Rollups& r) {
+    report(out, "minute", r.minutes);
+    report(out, "hour", r.hours);
+    report(out, "day", r.days);
+}
+
+// Prometheus gauges for the last complete minute, hour and day
+inline void metrics(Print& out, const Rollups& r) {
+    const Bucket buckets[] = { r.minutes.read(1), r.hours.read(1), r.days.read(1) };
+    const char* const periods[] = { "minute", "hour", "day" };
+    const char* const names[] = { "min_ppm", "max_ppm", "avg_ppm", "above_warning_seconds", "above_critical_seconds" };
+
+    for (int m = 0; m < 5; m++) {
+        out.printf("# TYPE operame_co2_%s gauge\n", names[m]);
+        for (int p = 0; p < 3; p++) {
+            const Bucket& b = buckets[p];
+            if (!b.count) continue;
+            unsigned long v = m == 0 ? b.min : m == 1 ? b.max : m == 2 ? b.avg() : m == 3 ? b.warning : b.critical;
+            out.printf("operame_co2_%s{period=\"%s\"} %lu\n", names[m], periods[p], v);
+        }
+    }
+}
+
+// JSON array of the complete buckets, newest first, each [age, min, avg, max]
+// with age the seconds from the start of the bucket to the last reading
+template <typename Ring>
+void json(Print& out, const Ring& ring, uint32_t last) {
+    out.print('[');
+    uint32_t before = last + 1;
+    for (int ago = 1; ago < Ring::length; ago++) {
+        Bucket b = ring.read(ago);
+        if (!b.count) break;
+        if (b.start >= before) continue;  // again, after the ring moved on
+        out.printf("%s[%lu,%u,%d,%u]", ago > 1 ? "," : "", (unsigned long) (last - b.start), b.min, b.avg(), b.max);
+        before = b.start;
+    }
+    out.print(']');
+}
+
+inline void json(Print& out, const Rollups& r) {
+    out.print("{\"minutes\":");
+    json(out, r.minutes, r.last);
+    out.print(",\"hours\":");
+    json(out, r.hours, r.last);
+    out.print(",\"days\":");
+    json(out, r.days, r.last);
+    out.print("}\n");
+}
+
+} // namespace
@@ -0,0 +1,220 @@
+#include <Arduino.h>
+#include <limits.h>
+#include <esp_timer.h>
+#include <operame_stats.h>
+#include <operame_tasks.h>
+
+namespace OperameScheduler {
+
+struct Job {
+    const char*     name;
+    void          (*run)();
+    unsigned long   interval;       // ms
+    unsigned long   due;            // millis() at which the job should run
+
+    // Statistics since boot, readable from other tasks
+    std::atomic<unsigned long>  late_total;     // ms
+    std::atomic<unsigned long>  late_max;       // ms
+    OperameStats::Histogram     runtime;        // cycles, also counts the runs
+
+    // Bookkeeping of the timer wheel
+    enum State { PAUSED, WAITING, READY, RUNNING } state;
+    int             slot;
+    Job*            prev;
+    Job*            next;
+};
+
+// Cooperative scheduler for periodic jobs, one per task. Jobs hang in a hashed
+// timer wheel with 1 ms slots, so adding and rescheduling are O(1); run() only
+// visits the slots that passed since the previous call. All storage is fixed.
+class Scheduler {
+  public:
+    static const int max_jobs = 8;
+    static const int slots    = 64;
+
+    // Adds a job that first runs `first` ms from now, then every `interval` ms
+    Job* add(const char* name, void (*run)(), unsigned long interval, unsigned long first = 0) {
+        if (count == max_jobs) return nullptr;
+        Job* job = &jobs[count++];
+        job->name     = name;
+        job->run      = run;
+        job->interval = interval;
+        job->state    = Job::PAUSED;
+        job->prev     = job->next = nullptr;
+        job->late_total = job->late_max = 0;
+        job->runtime.clear();
+        resume(job, first);
+        return job;
+    }
+
+    // The new interval applies from now on
+    void set_interval(Job* job, unsigned long interval) {
+        job->interval = interval;
+        if (job->state == Job::WAITING) {
+            unlink(job);
+            job->due = millis() + interval;
+            insert(job);
+        }
+    }
+
+    void pause(Job* job) {
+        if (job->state == Job::WAITING) unlink(job);
+        job->state = Job::PAUSED;
+    }
+
+    void resume(Job* job, unsigned long delay = 0) {
+        if (job->state == Job::WAITING) unlink(job);
+        job->due = millis() + delay;
+        insert(job);
+    }
+
+    // Runs every job that is due, most overdue first
+    void run() {
+        unsigned long now = millis();
+        unsigned long ticks = std::min(now - cursor, (unsigned long) slots);
+
+        Job* ready[max_jobs];
+        int n = 0;
+        for (unsigned long t = 1; t <= ticks; t++) {
+            Job* job = wheel[(cursor + t) % slots];
+            while (job) {
+                Job* next = job->next;
+                if ((long) (job->due - now) <= 0) {
+                    unlink(job);
+                    job->state = Job::READY;
+                    int i = n++;
+                    while (i && (long) (ready[i - 1]->due - job->due) > 0) {
+                        ready[i] = ready[i - 1];
+                        i--;
+                    }
+                    ready[i] = job;
+                }
+                job = next;
+            }
+        }
+        cursor = now;
+
+        for (int i = 0; i < n; i++) {
+            Job* job = ready[i];
+            if (job->state != Job::READY) continue;  // paused by an earlier job
+
+            unsigned long late = millis() - job->due;
+            job->state = Job::RUNNING;
+            {
+                OperameStats::Timer timer(job->runtime);
+                job->run();
+            }
+
+            job->late_total.store(job->late_total.load(std::memory_order_relaxed) + late, std::memory_order_relaxed);
+            if (late > job->late_max.load(std::memory_order_relaxed)) job->late_max.store(late, std::memory_order_relaxed);
+
+            if (job->state != Job::RUNNING) continue;  // paused or resumed by itself
+            job->due += job->interval;
+            if ((long) (job->due - millis()) <= 0) job->due = millis() + job->interval;  // skip missed runs
+            insert(job);
+        }
+    }
+
+    // Milliseconds until the next job is due; 0 if one is overdue
+    unsigned long idle_time() const {
+        unsigned long now = millis();
+        long idle = LONG_MAX;
+        for (int i = 0; i < count; i++) {
+            if (jobs[i].state != Job::WAITING) continue;
+            idle = std::min(idle, (long) (jobs[i].due - now));
+        }
+        return std::max(idle, 0L);
+    }
+
+    // Sleeps until the next job is due, at least 1 ms so that other tasks
+    // run, or until wake(). Returns true when woken.
+    bool wait() {
+        int64_t start = esp_timer_get_time();
+        unsigned long ms = std::max(idle_time(), 1UL);
+        until.store(millis() + ms, std::memory_order_relaxed);
+        waiting.store(true, std::memory_order_release);
+        bool woken = doze.sleep(ms);
+        waiting.store(false, std::memory_order_relaxed);
+        slept(esp_timer_get_time() - start);
+        return woken;
+    }
+
+    // How much longer wait() sleeps unless woken, 0 while the task runs; may
+    // be called from any task
+    unsigned long sleeping_for() const {
+        if (!waiting.load(std::memory_order_acquire)) return 0;
+        long left = until.load(std::memory_order_relaxed) - millis();
+        return std::max(left, 0L);
+    }
+
+    // Counts `us` as time this task was asleep, e.g. in light sleep started
+    // by hand instead of in wait()
+    void slept(int64_t us) {
+        // Single writer; other tasks only read
+        asleep_us += us;
+        asleep_ms.store(asleep_ms.load(std::memory_order_relaxed) + asleep_us / 1000, std::memory_order_relaxed);
+        asleep_us %= 1000;
+        wakeups.store(wakeups.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Ends wait() early; may be called from any task or interrupt handler
+    void IRAM_ATTR wake() { doze.wake(); }
+
+    // May be called from any task
+    void report(Print& out) const {
+        for (int i = 0; i < count; i++) {
+            const Job& job = jobs[i];
+            unsigned long runs = job.runtime.count();
+            out.printf("%-10s %8lu runs, late avg %lu max %lu ms, ",
+                job.name, runs, job.late_total.load() / std::max(runs, 1UL), job.late_max.load());
+            job.runtime.report(out);
+            out.println();
+        }
+    }
+
+    // Share of the time since boot this task was awake, and how often it
+    // woke up; a proxy for current draw
+    void report_power(Print& out, const char* name) const {
+        if (!wakeups.load()) return;  // e.g. no network task without WiFi
+        uint64_t elapsed = std::max((esp_timer_get_time() - since) / 1000, (int64_t) 1);  // ms
+        uint32_t awake   = (uint32_t) elapsed - asleep_ms.load();  // modulo 2^32, like asleep_ms
+        uint64_t minutes = std::max(elapsed / 60000, (uint64_t) 1);
+        unsigned long permille = std::min(awake * 1000ULL / elapsed, 1000ULL);
+        out.printf("%-10s awake %lu.%lu%%, %lu wakeups/min\n", name,
+            permille / 10, permille % 10, (unsigned long) (wakeups.load() / minutes));
+    }
+
+  private:
+    void insert(Job* job) {
+        // Jobs that are already due go in the next slot to be visited
+        unsigned long tick = (long) (job->due - cursor) > 0 ? job->due : cursor + 1;
+        job->slot  = tick % slots;
+        job->prev  = nullptr;
+        job->next  = wheel[job->slot];
+        if (job->next) job->next->prev = job;
+        wheel[job->slot] = job;
+        job->state = Job::WAITING;
+    }
+
+    void unlink(Job* job) {
+        if (job->prev) job->prev->next = job->next;
+        else wheel[job->slot] = job->next;
+        if (job->next) job->next->prev = job->prev;
+        job->prev = job->next = nullptr;
+    }
+
+    Job             jobs[max_jobs];
+    int             count = 0;
+    Job*            wheel[slots] = {};
+    unsigned long   cursor = millis();
+
+    OperameTasks::Doze          doze;
+    const int64_t               since = esp_timer_get_time();  // us
+    uint32_t                    asleep_us = 0;      // not yet in asleep_ms
+    std::atomic<uint32_t>       asleep_ms { 0 };
+    std::atomic<uint32_t>       wakeups { 0 };
+    std::atomic<bool>           waiting { false };
+    std::atomic<unsigned long>  until { 0 };        // millis() at which wait() ends
+};
+
+} // namespace
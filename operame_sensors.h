@@ -0,0 +1,233 @@
+#include <Arduino.h>
+#include <MHZ19.h>
+#include <operame_uart.h>
+
+namespace OperameSensors {
+
+// A driver talks to one kind of CO2 sensor. Every driver has the same
+// members, but no common base class: Chain below calls them directly, so a
+// build with a single driver has no dispatch and no code for other sensors.
+//
+//   bool probe()           at boot, may block; true if this sensor is present
+//   void begin()           at boot, for a sensor known to be present
+//   void request()         starts a measurement
+//   bool read(int& co2)    never blocks; true once a reading is in co2:
+//                          <0 means read error, 0 still initializing, >0 PPM
+//   void set_zero()        calibrates to zero_ppm() as the current level
+//   int  zero_ppm()
+//   bool warming_up()      readings are still init values
+//   const char* name()
+
+// CO2 sensors speaking the AQC protocol (command 0xc5)
+class AQC {
+  public:
+    explicit AQC(OperameUART::Transaction& uart, Stream& serial) : uart(uart), serial(serial) { }
+
+    bool probe() {
+        int co2;
+        request(1050);
+        while (!read(co2)) yield();
+        return co2 >= 0;
+    }
+
+    void begin() { }
+
+    void request(unsigned long timeout = 150) {
+        const uint8_t command[9] = { 0xff, 0x01, 0xc5, 0, 0, 0, 0, 0, 0x3a };
+        uart.start(command, 0x86, timeout);
+    }
+
+    bool read(int& co2) {
+        auto status = uart.poll();
+        if (status == uart.IDLE || status == uart.BUSY) return false;
+
+        if (status == uart.FAILED) {
+            initialized = false;
+            co2 = -1;
+            return true;
+        }
+
+        const uint8_t* response = uart.response();
+        co2 = response[2] * 256 + response[3];
+
+        // Reports 9999 or 400 until it has warmed up
+        if (!initialized && (co2 == 9999 || co2 == 400)) co2 = 0;
+        else initialized = true;
+        return true;
+    }
+
+    void set_zero() {
+        const uint8_t command[9] = { 0xff, 0x01, 0x87, 0, 0, 0, 0, 0, 0x78 };
+        // .available() sometimes stays true (why?), hence the limit
+        serial.flush();
+        for (int limit = 20; serial.available() && limit; limit--) serial.read();
+        serial.write(command, sizeof(command));
+    }
+
+    int zero_ppm() const { return 425; }
+    bool warming_up() const { return !initialized; }
+    const char* name() const { return "AQC"; }
+
+  private:
+    OperameUART::Transaction&   uart;
+    Stream&                     serial;
+    bool                        initialized = false;
+};
+
+// Winsen MH-Z19 and compatibles
+class MHZ {
+  public:
+    explicit MHZ(OperameUART::Transaction& uart, Stream& serial) : uart(uart), serial(serial) { }
+
+    // The MH-Z19 has nothing to probe for that the others would not answer,
+    // so it goes last and is always taken.
+    bool probe() {
+        begin();
+        return true;
+    }
+
+    void begin() {
+        mhz.begin(serial);
+        // mhz.setFilter(true, true);  Library filter doesn't handle 0436
+        mhz.autoCalibration(true);
+        char v[5] = {};
+        mhz.getVersion(v);
+        v[4] = '\0';
+        if (strcmp("0436", v) == 0) init_value = 436;
+    }
+
+    // After a failed exchange the version is asked again first, as begin()
+    // did at boot, in case the sensor was replaced or restarted. Automatic
+    // calibration is a setting the sensor keeps, so it is not sent again.
+    void request() {
+        if (reinit) {
+            const uint8_t command[9] = { 0xff, 0x01, 0xa0, 0, 0, 0, 0, 0, 0x5f };
+            uart.start(command, 0xa0, 150);
+            return;
+        }
+        start_sample();
+    }
+
+    // A sample is a single 0x85 exchange. The 0x86 value is only needed to
+    // recognise the init value, so it is read during warm-up, for every
+    // sample that shows the init value, and otherwise once a minute in case
+    // the sensor restarted by itself.
+    bool read(int& co2) {
+        auto status = uart.poll();
+        if (status == uart.IDLE || status == uart.BUSY) return false;
+
+        if (status == uart.FAILED) {
+            warmed_up = false;
+            reinit = true;
+            co2 = -1;
+            return true;
+        }
+
+        const uint8_t* response = uart.response();
+        if (response[1] == 0xa0) {
+            if (!memcmp(response + 2, "0436", 4)) init_value = 436;
+            reinit = false;
+            start_sample();
+            return false;
+        }
+        if (response[1] == 0x85) {
+            unlimited = response[4] * 256 + response[5];
+            if (unlimited == init_value) warmed_up = false;
+            if (warmed_up && ++samples % 12) {
+                co2 = unlimited > 10000 ? 0 : unlimited;
+                return true;
+            }
+            const uint8_t command[9] = { 0xff, 0x01, 0x86, 0, 0, 0, 0, 0, 0x79 };
+            uart.start(command, 0x86, 150);
+            return false;
+        }
+
+        int unclamped = response[2] * 256 + response[3];
+        co2 = filter(unlimited, unclamped);
+        // Keeps checking while the 0x86 value is the init value
+        warmed_up = co2 > 0 && unclamped != init_value;
+        return true;
+    }
+
+    void set_zero() { mhz.calibrate(); }
+
+    int zero_ppm() const { return 400; }
+    bool warming_up() const { return !warmed_up; }
+    const char* name() const { return "MHZ"; }
+
+  private:
+    void start_sample() {
+        const uint8_t command[9] = { 0xff, 0x01, 0x85, 0, 0, 0, 0, 0, 0x7a };
+        uart.start(command, 0x85, 150);
+    }
+
+    int filter(int co2, int unclamped) const {
+        // reimplement filter from library, but also checking for 436 because our
+        // sensors (firmware 0436, coincidence?) return that instead of 410...
+        if (unclamped == init_value && co2 - unclamped >= 10) return 0;
+
+        // No known sensors support >10k PPM (library filter tests for >32767)
+        if (co2 > 10000 || unclamped > 10000) return 0;
+
+        return co2;
+    }
+
+    OperameUART::Transaction&   uart;
+    Stream&                     serial;
+    MHZ19                       mhz;
+    int                         init_value = 410;  // magic value reported during init
+    bool                        warmed_up = false;
+    bool                        reinit = false;     // ask the version at the next request()
+    int                         unlimited = 0;
+    int                         samples = 0;
+};
+
+// The drivers to probe at boot, in order; afterwards every call goes to the
+// one that found its sensor.
+template <typename... Drivers>
+class Chain;
+
+template <>
+class Chain<> {
+  public:
+    bool probe() { return false; }
+    bool select(const char* name) { return false; }
+    void request() { }
+    bool read(int& co2) { return false; }
+    void set_zero() { }
+    int zero_ppm() const { return 0; }
+    bool warming_up() const { return true; }
+    const char* name() const { return "none"; }
+};
+
+template <typename First, typename... Rest>
+class Chain<First, Rest...> {
+  public:
+    explicit Chain(First& first, Rest&... rest) : first(first), rest(rest...) { }
+
+    bool probe() {
+        found = first.probe();
+        return found || rest.probe();
+    }
+
+    // Takes the driver with this name without probing
+    bool select(const char* name) {
+        found = !strcmp(first.name(), name);
+        if (found) first.begin();
+        return found || rest.select(name);
+    }
+
+    void request()              { found ? first.request()    : rest.request(); }
+    bool read(int& co2)         { return found ? first.read(co2) : rest.read(co2); }
+    void set_zero()             { found ? first.set_zero()   : rest.set_zero(); }
+    int zero_ppm() const        { return found ? first.zero_ppm()   : rest.zero_ppm(); }
+    bool warming_up() const     { return found ? first.warming_up() : rest.warming_up(); }
+    const char* name() const    { return found ? first.name()       : rest.name(); }
+
+  private:
+    First&          first;
+    Chain<Rest...>  rest;
+    bool            found = false;
+};
+
+} // namespace
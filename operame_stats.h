@@ -0,0 +1,153 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <limits.h>
+
+namespace OperameStats {
+
+// CPU cycles since some point; wraps after 2^32 / clock, 17.9 s at 240 MHz
+inline uint32_t cycles() {
+    return ESP.getCycleCount();
+}
+
+// Distribution of durations in CPU cycles, in 64 fixed logarithmic buckets:
+// two per power of two, so percentiles are accurate to within 50%. One task
+// records, any task may read; relaxed atomics keep that free of locks and of
+// read-modify-write instructions.
+class Histogram {
+  public:
+    static const int buckets = 64;
+
+    void add(uint32_t v) {
+        bump(counts[bucket(v)]);
+        bump(total);
+        if (v > peak.load(std::memory_order_relaxed)) peak.store(v, std::memory_order_relaxed);
+    }
+
+    void clear() {
+        for (auto& c : counts) c.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        peak.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t count() const { return total.load(std::memory_order_relaxed); }
+    uint32_t max() const { return peak.load(std::memory_order_relaxed); }
+
+    // Upper bound of the bucket that holds the given fraction of the values
+    uint32_t percentile(float fraction) const {
+        uint32_t n = count();
+        if (!n) return 0;
+        uint32_t rank = std::max((uint32_t) (fraction * n + 0.5f), 1U), seen = 0;
+        for (int i = 0; i < buckets; i++) {
+            seen += counts[i].load(std::memory_order_relaxed);
+            if (seen >= rank) return std::min(upper(i), max());
+        }
+        return max();
+    }
+
+    // "p50 12 p99 340 max 1020 us"
+    void report(Print& out) const {
+        uint32_t mhz = ESP.getCpuFreqMHz();
+        out.printf("p50 %lu p99 %lu max %lu us",
+            (unsigned long) (percentile(.50) / mhz),
+            (unsigned long) (percentile(.99) / mhz),
+            (unsigned long) (max() / mhz));
+    }
+
+  private:
+    static void bump(std::atomic<uint32_t>& c) {
+        c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Bucket 2m holds [2^m, 1.5 * 2^m), bucket 2m + 1 holds [1.5 * 2^m, 2^(m+1))
+    static int bucket(uint32_t v) {
+        if (v < 2) return v;
+        int m = 31 - __builtin_clz(v);
+        return 2 * m + ((v >> (m - 1)) & 1);
+    }
+
+    static uint32_t upper(int i) {
+        if (i < 2) return i;
+        int m = i / 2;
+        uint32_t half = 1UL << (m - 1);
+        return (1UL << m) + (i & 1) * half + (half - 1);
+    }
+
+    std::atomic<uint32_t> counts[buckets] {};
+    std::atomic<uint32_t> total { 0 };
+    std::atomic<uint32_t> peak { 0 };
+};
+
+// Records how long the enclosing scope takes; durations longer than the
+// cycle counter covers are recorded as the maximum.
+class Timer {
+  public:
+    explicit Timer(Histogram& h) : h(h), start(cycles()), start_us(micros()) { }
+    ~Timer() {
+        uint32_t elapsed = cycles() - start;
+        if (micros() - start_us >= UINT32_MAX / ESP.getCpuFreqMHz()) elapsed = UINT32_MAX;
+        h.add(elapsed);
+    }
+
+  private:
+    Histogram&      h;
+    uint32_t        start;
+    unsigned long   start_us;
+};
+
+// Print target for building a message, e.g. a report to publish, in place
+template <size_t size>
+class Buffer : public Print {
+  public:
+    size_t write(uint8_t c) override {
+        if (length + 1 >= size) return 0;
+        data[length++] = c;
+        data[length] = '\0';
+        return 1;
+    }
+
+    void clear() { length = 0; data[0] = '\0'; }
+    const char* c_str() const { return data; }
+    size_t  length = 0;
+
+  private:
+    char    data[size] = "";
+};
+
+// Print target that cuts text into messages of whole lines of less than
+// `size` bytes each, e.g. a report larger than one MQTT message. Each message
+// goes to `send` once the next line no longer fits, the last one at finish().
+// Only a single line longer than a message is cut mid-line.
+template <size_t size>
+class Messages : public Print {
+  public:
+    typedef void (*Send)(const char* data, size_t length);
+
+    explicit Messages(Send send) : send(send) { }
+
+    size_t write(uint8_t c) override {
+        if (length + 1 >= size) {
+            size_t cut = lines ? lines : length;
+            send(data, cut);
+            memmove(data, data + cut, length - cut);
+            length -= cut;
+            lines = 0;
+        }
+        data[length++] = c;
+        if (c == '\n') lines = length;
+        return 1;
+    }
+
+    void finish() {
+        if (length) send(data, length);
+        length = lines = 0;
+    }
+
+  private:
+    Send    send;
+    char    data[size];
+    size_t  length = 0;
+    size_t  lines = 0;      // bytes of complete lines
+};
+
+} // namespace
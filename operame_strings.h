@@ -1,9 +1,8 @@
-#include <map>
-#include <vector>
-#include <list>
-
 namespace OperameLanguage {
 
+// Up to four lines of text on the screen, terminated by a nullptr
+typedef const char* Lines[5];
+
 struct Texts {
     const char
         *error_mqtt,
@@ -15,6 +14,9 @@ struct Texts {
         *error_format,
         *config_wifi,
         *config_ota,
+        *config_wifi_reuse_ip,
+        *config_power_save,
+        *config_http,
         *config_co2_warning,
         *config_co2_critical,
         *config_co2_blink,
@@ -26,55 +28,60 @@ struct Texts {
         *config_mqtt_interval,
         *config_mqtt_template,
         *config_template_info,
+        *config_mqtt_batch,
+        *config_mqtt_rate,
+        *config_mqtt_stats,
+        *config_capture,
         *connecting,
         *wait
     ;
-    std::vector<std::list<String>> portal_instructions;
-    std::list<String> first_run;
-    std::list<String> calibration;
-    std::list<String> calibrating;
+    Lines portal_instructions[4];
+    Lines first_run;
+    Lines calibration;
+    Lines calibrating;
 };
 
-std::map<const String, const String> languages {
-    // Ordered alphabetically
-    { "en", "English" },
-    { "nl", "Nederlands" },
+struct Language {
+    const char* code;
+    const char* name;
+    Texts       texts;
 };
 
-bool available(const String& language) {
-    return languages.count(language) == 1;
-}
-
-bool select(Texts& T, String language) {
-    if (! available(language)) {
-        if (available("en")) language = "en";
-        else language = languages.begin()->first;
-    }
-
-    if (language == "en") {
-        T.error_mqtt = "MQTT unreachable";
-        T.error_driver = "driver error";
-        T.error_module = "module turned around!";
-        T.error_timeout = "Time's up";
-        T.error_sensor = "sensor error";
-        T.error_wifi = "WiFi failed!";
-        T.error_format = "Formatting failed";
-        T.wait = "wait...";
-        T.config_wifi = "Use WiFi connection";
-        T.config_ota = "Enable wireless reprogramming. (Uses portal password!)";
-        T.config_co2_warning = "Yellow from [ppm]";
-        T.config_co2_critical = "Red from [ppm]";
-        T.config_co2_blink = "Blink from [ppm]";
-        T.config_mqtt = "Publish measurements via the MQTT protocol";
-        T.config_mqtt_server = "Broker";  // probably should not be translated
-        T.config_mqtt_port = "Broker TCP port";
-        T.config_max_failures = "Number of failed connections before automatic restart";
-        T.config_mqtt_topic = "Topic";  // probably should not be translated
-        T.config_mqtt_interval = "Publication interval [s]";
-        T.config_mqtt_template = "Message template";
-        T.config_template_info = "The {} in the template is replaced by the measurement value.";
-        T.connecting = "Connecting to WiFi...";
-        T.portal_instructions = {
+// Constant tables, so they stay in flash instead of being built on the heap.
+// The fields of each entry must be given in the order of the declaration.
+const Language languages[] = {
+    // Ordered alphabetically
+    { "en", "English", {
+        .error_mqtt = "MQTT unreachable",
+        .error_driver = "driver error",
+        .error_module = "module turned around!",
+        .error_timeout = "Time's up",
+        .error_sensor = "sensor error",
+        .error_wifi = "WiFi failed!",
+        .error_format = "Formatting failed",
+        .config_wifi = "Use WiFi connection",
+        .config_ota = "Enable wireless reprogramming. (Uses portal password!)",
+        .config_wifi_reuse_ip = "Reuse the last IP address after a restart, skipping DHCP (only where the address is reserved)",
+        .config_power_save = "Power saving: WiFi modem sleep, slower polling and, where supported, light sleep",
+        .config_http = "Serve /metrics (Prometheus) and /history.json over HTTP on port 80",
+        .config_co2_warning = "Yellow from [ppm]",
+        .config_co2_critical = "Red from [ppm]",
+        .config_co2_blink = "Blink from [ppm]",
+        .config_mqtt = "Publish measurements via the MQTT protocol",
+        .config_mqtt_server = "Broker",  // probably should not be translated
+        .config_mqtt_port = "Broker TCP port",
+        .config_max_failures = "Number of failed connections before automatic restart",
+        .config_mqtt_topic = "Topic",  // probably should not be translated
+        .config_mqtt_interval = "Publication interval [s]",
+        .config_mqtt_template = "Message template",
+        .config_template_info = "The {} in the template is replaced by the measurement value. Also available: {min}, {max} and {avg} since the previous message, {uptime} in seconds and {hostname}.",
+        .config_mqtt_batch = "Readings per catch-up message after an outage",
+        .config_mqtt_rate = "Catch-up messages per second",
+        .config_mqtt_stats = "Publish timing statistics every minute (topic/stats)",
+        .config_capture = "Record sensor UART traffic: 0 = off, 1 = serial console, 2 = flash (/capture.txt)",
+        .connecting = "Connecting to WiFi...",
+        .wait = "wait...",
+        .portal_instructions = {
             {
                 "For configuration,",
                 "connect to WiFi",
@@ -97,50 +104,55 @@ bool select(Texts& T, String language) {
                 "Or \"Restart device\"",
                 "when you're done."
             }
-        };
-        T.first_run = {
+        },
+        .first_run = {
             "DO NOT TURN OFF",
             "Initializing",
-            "flash memory.",
-        };
-        T.calibration = {
+            "flash memory."
+        },
+        .calibration = {
             "Manual calibration!",
             "Press button",
             "to cancel.",
             ""
-        };
-        T.calibrating = {
+        },
+        .calibrating = {
             "Assuming current",
             "CO2 level to be",
             "400 PPM."
-        };
-        return true;
-    }
-
-    if(language == "nl") {
-        T.error_mqtt = "MQTT onbereikbaar";
-        T.error_driver = "driverfout";
-        T.error_module = "module verkeerd om!";
-        T.error_timeout = "Tijd verstreken";
-        T.error_sensor = "sensorfout";
-        T.error_wifi = "WiFi mislukt!";
-        T.error_format = "Formatteren mislukt";
-        T.wait = "wacht...";
-        T.config_wifi = "WiFi-verbinding gebruiken";
-        T.config_ota = "Draadloos herprogrammeren inschakelen. (Gebruikt portaalwachtwoord!)";
-        T.config_co2_warning = "Geel vanaf [ppm]";
-        T.config_co2_critical = "Rood vanaf [ppm]";
-        T.config_co2_blink = "Knipperen vanaf [ppm]";
-        T.config_mqtt = "Metingen via het MQTT-protocol versturen";
-        T.config_mqtt_server = "Broker";  // zo heet dat in MQTT
-        T.config_mqtt_port = "Broker TCP-poort";
-        T.config_max_failures = "Aantal verbindingsfouten voor automatische herstart";
-        T.config_mqtt_topic = "Topic";  // zo heet dat in MQTT
-        T.config_mqtt_interval = "Publicatie-interval [s]";
-        T.config_mqtt_template = "Berichtsjabloon";
-        T.config_template_info = "De {} in het sjabloon wordt vervangen door de gemeten waarde.";
-        T.connecting = "Verbinden met WiFi...";
-        T.portal_instructions = {
+        }
+    } },
+    { "nl", "Nederlands", {
+        .error_mqtt = "MQTT onbereikbaar",
+        .error_driver = "driverfout",
+        .error_module = "module verkeerd om!",
+        .error_timeout = "Tijd verstreken",
+        .error_sensor = "sensorfout",
+        .error_wifi = "WiFi mislukt!",
+        .error_format = "Formatteren mislukt",
+        .config_wifi = "WiFi-verbinding gebruiken",
+        .config_ota = "Draadloos herprogrammeren inschakelen. (Gebruikt portaalwachtwoord!)",
+        .config_wifi_reuse_ip = "Na een herstart het vorige IP-adres hergebruiken, zonder DHCP (alleen als het adres gereserveerd is)",
+        .config_power_save = "Energiebesparing: WiFi-modemslaap, minder vaak pollen en waar mogelijk lichte slaap",
+        .config_http = "/metrics (Prometheus) en /history.json aanbieden via HTTP op poort 80",
+        .config_co2_warning = "Geel vanaf [ppm]",
+        .config_co2_critical = "Rood vanaf [ppm]",
+        .config_co2_blink = "Knipperen vanaf [ppm]",
+        .config_mqtt = "Metingen via het MQTT-protocol versturen",
+        .config_mqtt_server = "Broker",  // zo heet dat in MQTT
+        .config_mqtt_port = "Broker TCP-poort",
+        .config_max_failures = "Aantal verbindingsfouten voor automatische herstart",
+        .config_mqtt_topic = "Topic",  // zo heet dat in MQTT
+        .config_mqtt_interval = "Publicatie-interval [s]",
+        .config_mqtt_template = "Berichtsjabloon",
+        .config_template_info = "De {} in het sjabloon wordt vervangen door de gemeten waarde. Ook beschikbaar: {min}, {max} en {avg} sinds het vorige bericht, {uptime} in seconden en {hostname}.",
+        .config_mqtt_batch = "Metingen per inhaalbericht na een storing",
+        .config_mqtt_rate = "Inhaalberichten per seconde",
+        .config_mqtt_stats = "Elke minuut timingstatistieken publiceren (topic/stats)",
+        .config_capture = "Sensorverkeer over de UART opnemen: 0 = uit, 1 = seriële console, 2 = flash (/capture.txt)",
+        .connecting = "Verbinden met WiFi...",
+        .wait = "wacht...",
+        .portal_instructions = {
             {
                 "Voor configuratie,",
                 "verbind met WiFi",
@@ -163,29 +175,45 @@ bool select(Texts& T, String language) {
                 "Of \"Herstarten\"",
                 "als u klaar bent."
             }
-        };
-        T.first_run = {
+        },
+        .first_run = {
             "NIET",
             "UITSCHAKELEN",
             "Flashgeheugen",
             "wordt voorbereid."
-        };
-        T.calibration = {
+        },
+        .calibration = {
             "Handmatige",
             "calibratie!",
             "knop = stop",
             ""
-        };
-        T.calibrating = {
+        },
+        .calibrating = {
             "Het huidige CO2-",
             "niveau wordt",
             "aangenomen",
             "400 PPM te zijn."
-        };
-        return true;
+        }
+    } },
+};
+
+inline const Language* find(const String& code) {
+    for (const Language& language : languages) {
+        if (code == language.code) return &language;
     }
+    return nullptr;
+}
+
+inline bool available(const String& code) {
+    return find(code) != nullptr;
+}
 
-    return false;
+// Falls back to English, or else the first language in the table
+inline const Texts* select(const String& code) {
+    const Language* language = find(code);
+    if (!language) language = find("en");
+    if (!language) language = &languages[0];
+    return &language->texts;
 }
 
 } // namespace
@@ -0,0 +1,116 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+namespace OperameTasks {
+
+// Most recent value from a single producer task, readable by any number of
+// consumer tasks without locking (a seqlock). The value is stored as atomic
+// words so a reader that races a write just retries.
+template <typename T>
+class Latest {
+    static_assert(sizeof(T) % sizeof(uint32_t) == 0, "T must consist of whole words");
+    static const size_t words = sizeof(T) / sizeof(uint32_t);
+
+  public:
+    void publish(const T& value) {
+        uint32_t buffer[words];
+        memcpy(buffer, &value, sizeof(T));
+
+        uint32_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < words; i++) data[i].store(buffer[i], std::memory_order_relaxed);
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    // Copies the latest value and returns how many values have been published
+    // so far, so a consumer can tell whether it has seen this one before.
+    uint32_t read(T& value) const {
+        uint32_t buffer[words];
+        uint32_t before, after;
+        do {
+            before = seq.load(std::memory_order_acquire);
+            for (size_t i = 0; i < words; i++) buffer[i] = data[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = seq.load(std::memory_order_relaxed);
+        } while (before != after || (before & 1));
+
+        memcpy(&value, buffer, sizeof(T));
+        return before / 2;
+    }
+
+  private:
+    std::atomic<uint32_t> seq { 0 };
+    std::atomic<uint32_t> data[words] {};
+};
+
+// Calls `body` forever on a task of its own. On the ESP32 the task is pinned
+// to `core`; on the host the stand-ins start a thread. The body must block or
+// delay() now and then, or the idle task on its core starves and the watchdog
+// fires.
+inline void spawn(const char* name, void (*body)(), int core, uint32_t stack = 8192, int priority = 1) {
+#ifdef ESP32
+    xTaskCreatePinnedToCore(
+        [](void* body) { for (;;) ((void (*)()) body)(); },
+        name, stack, (void*) body, priority, nullptr, core
+    );
+#else
+    hal::start_task(name, body);
+#endif
+}
+
+// Sleep of one task that another task or an interrupt handler can cut short
+class Doze {
+  public:
+    // Returns true when woken before `ms` passed
+    bool sleep(unsigned long ms) {
+#ifdef ESP32
+        task = xTaskGetCurrentTaskHandle();
+        return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms)) > 0;
+#else
+        // Tasks of a simulation only switch in delay(), so this polls
+        unsigned long start = millis();
+        for (unsigned long slept; (slept = millis() - start) < ms; ) {
+            if (woken.exchange(false)) return true;
+            delay(std::min(ms - slept, 10UL));
+        }
+        return woken.exchange(false);
+#endif
+    }
+
+    void IRAM_ATTR wake() {
+#ifdef ESP32
+        TaskHandle_t t = task;
+        if (!t) return;
+        if (xPortInIsrContext()) {
+            BaseType_t yield = pdFALSE;
+            vTaskNotifyGiveFromISR(t, &yield);
+            if (yield) portYIELD_FROM_ISR();
+        } else {
+            xTaskNotifyGive(t);
+        }
+#else
+        woken = true;
+#endif
+    }
+
+  private:
+#ifdef ESP32
+    TaskHandle_t volatile   task = nullptr;
+#else
+    std::atomic<bool>       woken { false };
+#endif
+};
+
+// Whether tasks may block on something other than delay(). In simulations
+// on the host, tasks take turns and only switch in delay().
+inline bool preemptive() {
+#ifdef ESP32
+    return true;
+#else
+    return !hal::simulated;
+#endif
+}
+
+} // namespace
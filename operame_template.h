@@ -0,0 +1,108 @@
+#include <Arduino.h>
+
+namespace OperameTemplate {
+
+// Values available to message templates
+struct Values {
+    int             co2;        // {}
+    uint32_t        uptime;     // {uptime}, seconds
+    const char*     hostname;   // {hostname}
+    int             min;        // {min}, since the previous message
+    int             max;        // {max}
+    int             avg;        // {avg}
+};
+
+// Appends the decimal representation of v; returns the new length
+inline size_t append(char* buf, size_t size, size_t length, long v) {
+    char digits[12];
+    int n = 0;
+    unsigned long u = v < 0 ? -(unsigned long) v : v;
+    do digits[n++] = '0' + u % 10; while (u /= 10);
+    if (v < 0) digits[n++] = '-';
+    while (n && length + 1 < size) buf[length++] = digits[--n];
+    buf[length] = '\0';
+    return length;
+}
+
+inline size_t append(char* buf, size_t size, size_t length, const char* s, size_t n) {
+    while (n-- && *s && length + 1 < size) buf[length++] = *s++;
+    buf[length] = '\0';
+    return length;
+}
+
+// A message template such as "{} PPM", split once into literal text and
+// placeholders so that rendering is a single pass into a caller's buffer,
+// without allocations. Unknown placeholders are kept as literal text.
+class Template {
+  public:
+    static const int max_segments = 16;
+
+    // The template text is referenced, not copied, and must stay unchanged.
+    // Placeholders beyond what fits in max_segments are kept as literal text.
+    void parse(const char* text) {
+        count = 0;
+        const char* literal = text;
+        for (const char* p = text; *p; p++) {
+            if (*p != '{') continue;
+            const char* end = strchr(p, '}');
+            if (!end) break;
+            Field field = lookup(p + 1, end - p - 1);
+            if (field == LITERAL) continue;
+            // Room for a literal, this field and the literal after it
+            if (count + 3 > max_segments) break;
+            if (p > literal) segments[count++] = { LITERAL, literal, (uint16_t) (p - literal) };
+            segments[count++] = { field, nullptr, 0 };
+            literal = end + 1;
+            p = end;
+        }
+        if (*literal) segments[count++] = { LITERAL, literal, (uint16_t) strlen(literal) };
+    }
+
+    // Always NUL-terminates; output that does not fit is cut off
+    size_t render(char* buf, size_t size, const Values& v) const {
+        size_t length = 0;
+        buf[0] = '\0';
+        for (int i = 0; i < count; i++) {
+            const Segment& s = segments[i];
+            switch (s.field) {
+                case LITERAL:   length = append(buf, size, length, s.text, s.length); break;
+                case VALUE:     length = append(buf, size, length, v.co2); break;
+                case UPTIME:    length = append(buf, size, length, v.uptime); break;
+                case HOSTNAME:  length = append(buf, size, length, v.hostname, SIZE_MAX); break;
+                case MIN:       length = append(buf, size, length, v.min); break;
+                case MAX:       length = append(buf, size, length, v.max); break;
+                case AVG:       length = append(buf, size, length, v.avg); break;
+            }
+        }
+        return length;
+    }
+
+  private:
+    enum Field { LITERAL, VALUE, UPTIME, HOSTNAME, MIN, MAX, AVG };
+
+    struct Segment {
+        Field           field;
+        const char*     text;
+        uint16_t        length;
+    };
+
+    static Field lookup(const char* name, size_t n) {
+        static const struct { const char* name; Field field; } names[] = {
+            { "",           VALUE },
+            { "uptime",     UPTIME },
+            { "hostname",   HOSTNAME },
+            { "min",        MIN },
+            { "max",        MAX },
+            { "avg",        AVG },
+        };
+        for (auto& entry : names) {
+            if (strlen(entry.name) == n && !strncmp(entry.name, name, n)) return entry.field;
+        }
+        return LITERAL;
+    }
+
+    Segment     segments[max_segments];
+    int         count = 0;
+};
+
+} // namespace
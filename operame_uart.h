@@ -0,0 +1,94 @@
+#pragma once
+#include <Arduino.h>
+
+namespace OperameUART {
+
+// One request/response exchange of 9-byte frames (0xff, ..., checksum) as
+// spoken by MH-Z19 compatible sensors. Nothing here waits: poll() consumes
+// whatever bytes have arrived and returns straight away, so it can be called
+// from loop() on every iteration.
+class Transaction {
+  public:
+    enum Status { IDLE, BUSY, OK, FAILED };
+
+    explicit Transaction(Stream& serial) : serial(serial) { }
+
+    // Sends `command` and expects a response whose second byte is `reply`,
+    // resending up to `attempts` times when none arrives within `timeout` ms.
+    void start(const uint8_t* command, uint8_t reply, unsigned long timeout, int attempts = 3) {
+        memcpy(this->command, command, sizeof(this->command));
+        this->reply    = reply;
+        this->timeout  = timeout;
+        this->attempts = attempts;
+        attempt = 0;
+        send();
+    }
+
+    // Returns OK or FAILED once when the exchange completes, BUSY while it is
+    // in progress and IDLE when nothing was started.
+    Status poll() {
+        if (status != BUSY) return status;
+
+        // Bounded per call, in case the line is spewing garbage
+        for (int limit = 32; limit && got < sizeof(buffer) && serial.available(); limit--) {
+            uint8_t b = serial.read();
+            if (got == 0 && b != 0xff) continue;
+            if (got == 1 && b != reply) {
+                got = b == 0xff;  // resynchronize
+                continue;
+            }
+            buffer[got++] = b;
+        }
+
+        if (got == sizeof(buffer)) {
+            if (buffer[8] == checksum(buffer)) return finish(OK);
+            return retry();
+        }
+        if (millis() - sent_at >= timeout) return retry();
+        return BUSY;
+    }
+
+    bool busy() const { return status == BUSY; }
+
+    // Valid after poll() returned OK
+    const uint8_t* response() const { return buffer; }
+
+    static uint8_t checksum(const uint8_t* frame) {
+        uint8_t sum = 0;
+        for (int i = 1; i < 8; i++) sum += frame[i];
+        return 0xff - sum + 1;
+    }
+
+  private:
+    void send() {
+        for (int limit = 20; serial.available() && limit; limit--) serial.read();
+        serial.write(command, sizeof(command));
+        sent_at = millis();
+        got = 0;
+        status = BUSY;
+    }
+
+    Status retry() {
+        if (++attempt >= attempts) return finish(FAILED);
+        send();
+        return BUSY;
+    }
+
+    Status finish(Status result) {
+        status = IDLE;
+        return result;
+    }
+
+    Stream&         serial;
+    uint8_t         command[9];
+    uint8_t         buffer[9];
+    size_t          got = 0;
+    uint8_t         reply = 0;
+    unsigned long   timeout = 0;
+    unsigned long   sent_at = 0;
+    int             attempts = 0;
+    int             attempt = 0;
+    Status          status = IDLE;
+};
+
+} // namespace
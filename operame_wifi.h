@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <SPIFFS.h>
+
+namespace OperameWiFi {
+
+// Where the last successful association went, kept in flash so that it
+// survives power cuts. A full connect scans every channel for the access
+// point and then waits for DHCP; with these it can go straight to the right
+// access point on the right channel and, where addresses are reserved, skip
+// DHCP as well.
+struct Cache {
+    uint32_t    magic;
+    char        ssid[33];
+    uint8_t     bssid[6];
+    uint8_t     channel;
+    uint32_t    ip, gateway, subnet, dns;
+};
+
+const uint32_t      magic = 0x31494657;  // "WFI1"
+const char* const   path  = "/wifi-cache";
+
+inline bool load(Cache& cache) {
+    File f = SPIFFS.open(path, FILE_READ);
+    return f && f.read((uint8_t*) &cache, sizeof(cache)) == sizeof(cache) && cache.magic == magic;
+}
+
+inline void forget() {
+    SPIFFS.remove(path);
+}
+
+// Saves the current association; only writes when it changed
+inline void remember() {
+    Cache cache = {};
+    cache.magic = magic;
+    strncpy(cache.ssid, WiFi.SSID().c_str(), sizeof(cache.ssid) - 1);
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel = WiFi.channel();
+    cache.ip      = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.subnet  = WiFi.subnetMask();
+    cache.dns     = WiFi.dnsIP();
+
+    Cache old;
+    if (load(old) && !memcmp(&old, &cache, sizeof(cache))) return;
+    File f = SPIFFS.open(path, FILE_WRITE);
+    if (f) f.write((const uint8_t*) &cache, sizeof(cache));
+}
+
+// Associates with the cached access point, and with `reuse_ip` also takes the
+// cached address instead of asking DHCP. Calls `waiting` every 50 ms. Gives up
+// after `timeout` ms, undoing the static address so that a full connect
+// starts clean.
+template <typename Callback>
+bool reconnect(const Cache& cache, const char* password, bool reuse_ip, unsigned long timeout, Callback waiting) {
+    WiFi.mode(WIFI_STA);
+    if (reuse_ip) WiFi.config(cache.ip, cache.gateway, cache.subnet, cache.dns);
+    WiFi.begin(cache.ssid, password, cache.channel, cache.bssid);
+
+    unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED) {
+        if (millis() - start >= timeout) {
+            WiFi.disconnect();
+            if (reuse_ip) WiFi.config((uint32_t) 0, (uint32_t) 0, (uint32_t) 0);
+            return false;
+        }
+        waiting();
+        delay(50);
+    }
+    return true;
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+#include <vector>
+#include <operame_glyphs.h>
+
+static TFT_eSPI tft;
+static TFT_eSprite canvas(&tft);
+static OperameGlyphs::Atlas atlas;
+
+static std::vector<uint8_t> pixels() {
+    const uint8_t* p = (const uint8_t*) canvas.getPointer();
+    return std::vector<uint8_t>(p, p + (canvas.width() + 1) / 2 * canvas.height());
+}
+
+void setUp() {
+    canvas.fillSprite(3);
+}
+
+void tearDown() { }
+
+// The atlas must draw what drawString() draws, at even and odd positions
+void test_same_as_draw_string() {
+    TEST_ASSERT_TRUE(atlas.built(8));
+    const char* numbers[] = { "0", "7", "42", "415", "1234", "9999" };
+    for (const char* text : numbers) {
+        for (int x = 118; x <= 121; x++) {
+            canvas.fillSprite(3);
+            canvas.setTextDatum(MC_DATUM);
+            canvas.setTextColor(5, 9);
+            canvas.drawString(text, x, 67);
+            std::vector<uint8_t> expected = pixels();
+
+            canvas.fillSprite(3);
+            TEST_ASSERT_TRUE(atlas.draw(canvas, text, x, 67, 5, 9));
+            TEST_ASSERT_TRUE_MESSAGE(pixels() == expected, text);
+        }
+    }
+}
+
+void test_refuses_what_it_cannot_draw() {
+    TEST_ASSERT_FALSE(atlas.draw(canvas, "12a", 120, 67, 5, 9));
+    TEST_ASSERT_FALSE(atlas.draw(canvas, "", 120, 67, 5, 9));
+    TEST_ASSERT_FALSE(atlas.draw(canvas, "123456", 120, 67, 5, 9));
+    TEST_ASSERT_FALSE(atlas.draw(canvas, "1234", 20, 67, 5, 9));  // off the left edge
+}
+
+// Not a pass/fail check: the host time per four-digit readout. drawString()
+// here costs one drawPixel() per pixel of the cell, like the real library's
+// decoding of the run-length encoded fonts into a sprite.
+void test_draw_time() {
+    const int n = 2000;
+    canvas.setTextDatum(MC_DATUM);
+    canvas.setTextColor(5, 9);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) canvas.drawString("1234", 120 + (i & 1), 67);
+    std::chrono::duration<double, std::micro> font = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) atlas.draw(canvas, "1234", 120 + (i & 1), 67, 5, 9);
+    std::chrono::duration<double, std::micro> masks = std::chrono::steady_clock::now() - start;
+
+    // Worst case, with the colour table rebuilt for every call
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) atlas.draw(canvas, "1234", 120 + (i & 1), 67, i & 1 ? 5 : 6, 9);
+    std::chrono::duration<double, std::micro> recolored = std::chrono::steady_clock::now() - start;
+
+    printf("4 digits of font 8: drawString() %.1f us, atlas %.1f us, %.1f us with a colour change\n",
+        font.count() / n, masks.count() / n, recolored.count() / n);
+}
+
+int main() {
+    canvas.setColorDepth(4);
+    canvas.createSprite(240, 135);
+    atlas.build(canvas, 8);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_same_as_draw_string);
+    RUN_TEST(test_refuses_what_it_cannot_draw);
+    RUN_TEST(test_draw_time);
+    return UNITY_END();
+}
@@ -0,0 +1,192 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <SPIFFS.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <hal.h>
+#include <operame_history.h>
+
+struct Sample {
+    uint32_t    seconds;
+    int         co2;
+};
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Every sample in the ring, oldest block first
+static std::vector<Sample> decode() {
+    std::vector<std::pair<uint32_t, int>> order;  // sequence, block
+    for (int block = 0; block < OperameHistory::blocks; block++) {
+        OperameHistory::Reader reader;
+        if (reader.open(block)) order.emplace_back(reader.info().sequence, block);
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<Sample> samples;
+    for (auto& o : order) {
+        OperameHistory::Reader reader;
+        reader.open(o.second);
+        Sample s;
+        while (reader.next(s.seconds, s.co2)) samples.push_back(s);
+    }
+    return samples;
+}
+
+static void check(const std::vector<Sample>& expected, const std::vector<Sample>& got) {
+    TEST_ASSERT_EQUAL_INT(expected.size(), got.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(expected[i].seconds, got[i].seconds);
+        TEST_ASSERT_EQUAL_INT(expected[i].co2, got[i].co2);
+    }
+}
+
+// Logs `samples`, checks that they decode to the same, and prints the size
+// against 6 bytes per sample for a plain time and ppm
+static void round_trip(const char* name, const std::vector<Sample>& samples) {
+    OperameHistory::Log log;
+    log.begin(5);
+    auto start = std::chrono::steady_clock::now();
+    for (auto& s : samples) log.add(s.seconds, s.co2);
+    log.flush();
+    double add_ns = elapsed_ns(start);
+
+    std::vector<Sample> logged;
+    for (auto& s : samples) if (s.co2 > 0) logged.push_back(s);
+    start = std::chrono::steady_clock::now();
+    std::vector<Sample> decoded = decode();
+    double next_ns = elapsed_ns(start);
+    check(logged, decoded);
+
+    printf("%s: %zu samples in %zu bytes, %.2f bytes per sample, %.1fx smaller; add() %.0f ns, decode %.0f ns per sample\n",
+        name, logged.size(), log.bytes(), (double) log.bytes() / logged.size(), 6.0 * logged.size() / log.bytes(),
+        add_ns / samples.size(), next_ns / logged.size());
+}
+
+// The readings printed in a sensor trace, one per 5 s
+static std::vector<Sample> trace(const char* name) {
+    std::string path = __FILE__;
+    path.erase(path.find_last_of('/') + 1);
+    path += std::string("../traces/") + name;
+
+    std::vector<Sample> samples;
+    FILE* f = fopen(path.c_str(), "r");
+    TEST_ASSERT_TRUE_MESSAGE(f, path.c_str());
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        char* end;
+        long v = strtol(line, &end, 10);
+        if (end != line && (*end == '\n' || *end == '\0')) samples.push_back({ 5 * ((uint32_t) samples.size() + 1), (int) v });
+    }
+    fclose(f);
+    return samples;
+}
+
+void setUp() {
+    SPIFFS.begin();
+    SPIFFS.format();
+}
+
+void tearDown() { }
+
+// A week of 5 s samples from the emulated classroom, with jitter, read
+// errors and a pause now and then, as when the sensor task was held up
+void test_week() {
+    std::vector<Sample> samples;
+    uint32_t t = 100;
+    for (int i = 0; i < 7 * 24 * 720; i++) {
+        t += 5;
+        if (i % 1000 == 999) t += 25;
+        int co2 = hal::co2_at(t * 1000UL) + i % 3 - 1;
+        if (i % 777 == 0) co2 = -1;
+        samples.push_back({ t, co2 });
+    }
+    round_trip("week", samples);
+}
+
+void test_large_steps() {
+    std::vector<Sample> samples;
+    for (int i = 0; i < 2000; i++) samples.push_back({ 5 * (uint32_t) i, i % 2 ? 400 : 5000 + i });
+    round_trip("steps", samples);
+}
+
+void test_mhz19_trace() {
+    round_trip("mhz19.txt", trace("mhz19.txt"));
+}
+
+void test_aqc_trace() {
+    round_trip("aqc.txt", trace("aqc.txt"));
+}
+
+// A reboot starts a new block with the next sequence number
+void test_continues_after_reboot() {
+    {
+        OperameHistory::Log log;
+        log.begin(5);
+        for (uint32_t t = 5; t <= 600; t += 5) log.add(t, 600);
+        log.flush();
+    }
+    OperameHistory::Log log;
+    log.begin(5);
+    for (uint32_t t = 5; t <= 60; t += 5) log.add(t, 700);
+    log.flush();
+
+    OperameHistory::Reader first, second;
+    TEST_ASSERT_TRUE(first.open(0));
+    TEST_ASSERT_TRUE(second.open(1));
+    TEST_ASSERT_EQUAL_UINT32(first.info().sequence + 1, second.info().sequence);
+    TEST_ASSERT_EQUAL_INT(132, decode().size());
+}
+
+// What restore_outbox() gets after two restarts: the marked boot from the
+// mark on, then all of the next, on one clock
+void test_since_mark() {
+    OperameHistory::Log a;
+    a.begin(5);
+    for (uint32_t t = 5; t <= 600; t += 5) a.add(t, 500 + t);
+    a.flush();
+    OperameHistory::set_mark(a.first_sequence(), 300);
+
+    OperameHistory::Log b;
+    b.begin(5);
+    for (uint32_t t = 5; t <= 100; t += 5) b.add(t, 2000 + t);
+    b.flush();
+
+    OperameHistory::Log c;
+    c.begin(5);
+    c.add(5, 400);  // of this boot, so not replayed
+    c.flush();
+
+    OperameHistory::Mark mark;
+    TEST_ASSERT_TRUE(OperameHistory::get_mark(mark));
+    std::vector<Sample> got;
+    OperameHistory::since(mark, c.first_sequence(), [&](uint32_t ago, int co2) { got.push_back({ ago, co2 }); });
+
+    std::vector<Sample> expected;
+    for (uint32_t t = 300; t <= 600; t += 5) expected.push_back({ 600 - t + 100, (int) (500 + t) });
+    for (uint32_t t = 5; t <= 100; t += 5) expected.push_back({ 100 - t, (int) (2000 + t) });
+    check(expected, got);
+
+    OperameHistory::clear_mark();
+    TEST_ASSERT_FALSE(OperameHistory::get_mark(mark));
+}
+
+int main() {
+    char dir[] = "/tmp/operame-test-XXXXXX";
+    setenv("OPERAME_SPIFFS", mkdtemp(dir), 1);
+    UNITY_BEGIN();
+    RUN_TEST(test_week);
+    RUN_TEST(test_large_steps);
+    RUN_TEST(test_mhz19_trace);
+    RUN_TEST(test_aqc_trace);
+    RUN_TEST(test_continues_after_reboot);
+    RUN_TEST(test_since_mark);
+    int failures = UNITY_END();
+    SPIFFS.format();
+    rmdir(dir);
+    return failures;
+}
@@ -0,0 +1,217 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <hal.h>
+#include <operame_scheduler.h>
+#include <operame_http.h>
+
+// Boots the firmware with the HTTP server on the virtual clock, first without
+// and then with 200 requests per second, and checks the answers, that the
+// pages are only formatted again after a new reading, and that the sensor
+// poll and render jobs keep their cadence under the load. Host CPU time is
+// charged to the virtual clock as if every task ran on one core ten times
+// slower than the host, so serving that is too slow makes them late.
+
+void setup();
+void loop();
+extern HardwareSerial hwserial1;
+extern OperameScheduler::Job* sensor_poll_job;
+extern OperameScheduler::Job* render_job;
+extern OperameStats::Histogram rollup_time;
+extern OperameHTTP::Document<2048> metrics_page;
+extern OperameHTTP::Document<4096> history_page;
+
+const int ppm = 1234;
+
+// Lateness of a job over a phase of the run
+struct Lateness {
+    unsigned long   runs;
+    unsigned long   avg_us;
+    unsigned long   max_ms;
+};
+
+struct Phase {
+    Lateness        poll, render;
+    unsigned long   readings;
+};
+
+static Phase quiet, loaded;
+
+static void reset(OperameScheduler::Job* job, unsigned long& runs) {
+    runs = job->runtime.count();
+    job->late_total = 0;
+    job->late_max = 0;
+}
+
+static Lateness measure(OperameScheduler::Job* job, unsigned long since) {
+    unsigned long runs = job->runtime.count() - since;
+    return { runs, runs ? job->late_total * 1000 / runs : 0, job->late_max };
+}
+
+// The other tasks are stopped while one of these runs, so the statistics
+// hold still
+static void phase(unsigned long start, unsigned long end, Phase& result) {
+    static unsigned long poll_runs, render_runs, readings;
+    hal::at(start, [] {
+        reset(sensor_poll_job, poll_runs);
+        reset(render_job, render_runs);
+        readings = rollup_time.count();
+    });
+    hal::at(end, [&result] {
+        result.poll = measure(sensor_poll_job, poll_runs);
+        result.render = measure(render_job, render_runs);
+        result.readings = rollup_time.count() - readings;
+    });
+}
+
+// Requests every `period` ms from `start` until `end`, alternating pages
+static void load(unsigned long start, unsigned long end, unsigned long period) {
+    if (start >= end) return;
+    hal::at(start, [start, end, period] {
+        static unsigned long n = 0;
+        hal::http_get(80, n++ % 2 ? "/history.json" : "/metrics");
+        load(start + period, end, period);
+    });
+}
+
+static std::shared_ptr<hal::Connection> metrics, history, missing, post;
+
+static std::shared_ptr<hal::Connection> request(const char* text) {
+    auto c = std::make_shared<hal::Connection>();
+    c->request = text;
+    c->opened = millis();
+    hal::backlog(80).push_back(c);
+    return c;
+}
+
+static void simulate() {
+    hal::simulate();
+    hal::charge_cpu(10);
+    for (auto& level : hal::pin_level) level = HIGH;
+    hal::pin_level[12] = LOW;  // pin_pcb_ok
+    hal::co2_override = ppm;
+    hal::attach_sensor(hwserial1, "mhz");
+    hal::wifi_up = true;
+
+    // Warmed up by 90 s
+    phase(90000, 210000, quiet);
+    phase(210000, 330000, loaded);
+    load(210000, 330000, 5);
+    hal::at(300000, [] {
+        metrics = request("GET /metrics HTTP/1.1\r\nHost: operame\r\n\r\n");
+        history = request("GET /history.json?x=1 HTTP/1.0\r\n\r\n");
+        missing = request("GET /nothing HTTP/1.1\r\n\r\n");
+        post = request("POST /metrics HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+    });
+
+    static bool done = false;
+    hal::at(335000, [] { done = true; });
+    setup();
+    while (!done) loop();
+
+    for (const char* name : { "quiet", "loaded" }) {
+        const Phase& p = name[0] == 'q' ? quiet : loaded;
+        printf("%s: poll %lu runs, late avg %lu us max %lu ms; render %lu runs, late avg %lu us max %lu ms\n",
+            name, p.poll.runs, p.poll.avg_us, p.poll.max_ms, p.render.runs, p.render.avg_us, p.render.max_ms);
+    }
+    printf("http: %lu requests, %lu answered with 200; %lu readings, %lu + %lu renders\n",
+        hal::http.requests, hal::http.ok, loaded.readings, metrics_page.renders(), history_page.renders());
+}
+
+// Splits an answer into status line, Content-Length and body
+static void parse(const hal::Connection& c, std::string& status, long& length, std::string& body) {
+    TEST_ASSERT_TRUE(c.closed);
+    const std::string& r = c.response;
+    size_t end = r.find("\r\n\r\n");
+    TEST_ASSERT_TRUE(end != std::string::npos);
+    status = r.substr(0, r.find("\r\n"));
+    size_t at = r.find("Content-Length: ");
+    TEST_ASSERT_TRUE(at != std::string::npos && at < end);
+    length = atol(r.c_str() + at + 16);
+    body = r.substr(end + 4);
+}
+
+void setUp() { }
+void tearDown() { }
+
+void test_metrics() {
+    std::string status, body;
+    long length;
+    parse(*metrics, status, length, body);
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.0 200 OK", status.c_str());
+    TEST_ASSERT_TRUE(metrics->response.find("Content-Type: text/plain; version=0.0.4\r\n") != std::string::npos);
+    TEST_ASSERT_EQUAL_INT(body.size(), length);
+    TEST_ASSERT_TRUE(body.find("\noperame_co2_ppm 1234\n") != std::string::npos);
+    TEST_ASSERT_TRUE(body.find("operame_co2_avg_ppm{period=\"minute\"} 1234\n") != std::string::npos);
+    TEST_ASSERT_EQUAL_INT('\n', body.back());
+}
+
+void test_history() {
+    std::string status, body;
+    long length;
+    parse(*history, status, length, body);
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.0 200 OK", status.c_str());
+    TEST_ASSERT_TRUE(history->response.find("Content-Type: application/json\r\n") != std::string::npos);
+    TEST_ASSERT_EQUAL_INT(body.size(), length);
+    TEST_ASSERT_EQUAL_INT(0, body.find("{\"minutes\":[["));
+    TEST_ASSERT_TRUE(body.find(",1234,1234,1234]") != std::string::npos);
+    TEST_ASSERT_TRUE(body.find("],\"hours\":[") != std::string::npos);
+    TEST_ASSERT_EQUAL_STRING("]}\n", body.substr(body.size() - 3).c_str());
+}
+
+void test_not_found() {
+    for (auto* c : { &missing, &post }) {
+        std::string status, body;
+        long length;
+        parse(**c, status, length, body);
+        TEST_ASSERT_EQUAL_STRING("HTTP/1.0 404 Not Found", status.c_str());
+        TEST_ASSERT_EQUAL_INT(0, length);
+        TEST_ASSERT_EQUAL_INT(0, body.size());
+    }
+}
+
+// Each page at most once per reading, however many requests there were: all
+// of them came during the loaded phase, whose first request formats the pages
+// for the reading before it
+void test_renders_once_per_reading() {
+    TEST_ASSERT_EQUAL_UINT32(24000, hal::http.requests);
+    TEST_ASSERT_EQUAL_UINT32(24000 + 2, hal::http.ok);  // and test_metrics, test_history
+    TEST_ASSERT_TRUE(metrics_page.renders() > 0 && metrics_page.renders() <= loaded.readings + 1);
+    TEST_ASSERT_TRUE(history_page.renders() > 0 && history_page.renders() <= loaded.readings + 1);
+}
+
+// The sensor is polled every 2 ms while an exchange is in progress and the
+// display rendered every 50 ms; under load neither may fall behind by more
+// than a millisecond on average, nor run much later than without load
+void test_cadence_under_load() {
+    TEST_ASSERT_TRUE(loaded.render.runs >= quiet.render.runs * 99 / 100);
+    TEST_ASSERT_TRUE(loaded.poll.avg_us <= quiet.poll.avg_us + 1000);
+    TEST_ASSERT_TRUE(loaded.render.avg_us <= quiet.render.avg_us + 1000);
+    TEST_ASSERT_TRUE(loaded.poll.max_ms <= quiet.poll.max_ms + 5);
+    TEST_ASSERT_TRUE(loaded.render.max_ms <= quiet.render.max_ms + 5);
+}
+
+int main() {
+    char dir[] = "/tmp/operame-test-XXXXXX";
+    setenv("OPERAME_SPIFFS", mkdtemp(dir), 1);
+    setenv("operame_wifi", "1", 1);
+    setenv("operame_http", "1", 1);
+    simulate();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_metrics);
+    RUN_TEST(test_history);
+    RUN_TEST(test_not_found);
+    RUN_TEST(test_renders_once_per_reading);
+    RUN_TEST(test_cadence_under_load);
+    int failures = UNITY_END();
+    SPIFFS.format();
+    rmdir(dir);
+    // The firmware's tasks never end; leave without running destructors
+    fflush(stdout);
+    _exit(failures);
+}
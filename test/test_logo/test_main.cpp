@@ -0,0 +1,64 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+#include <logo.h>
+#include "baseline_logo.h"
+
+static const int logo_x = 12, logo_y = 30;  // where display_logo() puts it
+static const uint16_t background = 0x1234;
+
+void setUp() { }
+void tearDown() { }
+
+// The run-length encoded logo must decode to exactly the pixels of the array
+// it replaced, and draw nothing outside its own rectangle
+void test_logo_is_pixel_exact() {
+    TFT_eSPI tft;
+    TFT_eSprite canvas(&tft);
+    canvas.createSprite(240, 135);
+    canvas.fillSprite(background);
+    OperameImage::draw(canvas, logo_x, logo_y, OPERAME_LOGO);
+
+    TEST_ASSERT_EQUAL_INT(215, OPERAME_LOGO.width);
+    TEST_ASSERT_EQUAL_INT(76, OPERAME_LOGO.height);
+    int compared = 0;
+    for (int y = 0; y < canvas.height(); y++) {
+        for (int x = 0; x < canvas.width(); x++) {
+            bool inside = x >= logo_x && x < logo_x + 215 && y >= logo_y && y < logo_y + 76;
+            uint16_t expected = inside ? BASELINE_LOGO[(y - logo_y) * 215 + x - logo_x] : background;
+            if (canvas.readPixel(x, y) != expected) {
+                char where[48];
+                snprintf(where, sizeof(where), "pixel %d,%d of the logo", x - logo_x, y - logo_y);
+                TEST_FAIL_MESSAGE(where);
+            }
+            compared += inside;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(16340, compared);
+}
+
+// Prints the size against the 32680 bytes of the array, and the host time
+// to draw it
+void test_logo_size() {
+    size_t bytes = sizeof(OPERAME_LOGO_PALETTE) + sizeof(OPERAME_LOGO_RUNS);
+    printf("logo: %u runs, %u bytes against %u\n",
+        (unsigned) OPERAME_LOGO.count, (unsigned) bytes, (unsigned) sizeof(BASELINE_LOGO));
+    TEST_ASSERT_LESS_THAN(sizeof(BASELINE_LOGO), bytes);
+
+    TFT_eSPI tft;
+    TFT_eSprite canvas(&tft);
+    canvas.createSprite(240, 135);
+    const int n = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) OperameImage::draw(canvas, logo_x, logo_y, OPERAME_LOGO);
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    printf("logo: draw %.1f us\n", elapsed.count() / n);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_logo_is_pixel_exact);
+    RUN_TEST(test_logo_size);
+    return UNITY_END();
+}
@@ -0,0 +1,163 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <thread>
+#include <operame_stats.h>
+#include <operame_rollup.h>
+
+using OperameRollup::Bucket;
+
+// What a bucket should hold, summed the slow way
+struct Expected {
+    uint32_t    min = 0xffff, max = 0, count = 0, warning = 0, critical = 0;
+    uint64_t    sum = 0;
+};
+
+static void check(const Expected& e, const Bucket& b) {
+    TEST_ASSERT_EQUAL_UINT32(e.count, b.count);
+    TEST_ASSERT_EQUAL_UINT32(e.sum, b.sum);
+    TEST_ASSERT_EQUAL_UINT32(e.min, b.min);
+    TEST_ASSERT_EQUAL_UINT32(e.max, b.max);
+    TEST_ASSERT_EQUAL_UINT32(e.warning, b.warning);
+    TEST_ASSERT_EQUAL_UINT32(e.critical, b.critical);
+}
+
+static OperameRollup::Rollups week;
+
+// A reading every 5 s for a week, with failed readings now and then and a
+// soft reset every 100000 s, against hour and day totals kept in maps
+void test_week_matches_brute_force() {
+    const int warning = 800, critical = 1200;
+    std::map<uint32_t, Expected> hours, days;
+
+    memset((void*) &week, 0, sizeof(week));
+    week.begin(0);
+    uint32_t uptime = 0, last = 0;
+    bool continued = false;
+    int resets = 0;
+    srand(1);
+    for (uint32_t t = 0; t < 7 * 86400; t += 5) {
+        uptime += 5;
+        if (t % 100000 == 99995) {
+            // What RTC RAM keeps; the rest is garbage after the reset
+            memset((void*) &week.offset, 0xaa, sizeof(week) - offsetof(OperameRollup::Rollups, offset));
+            uptime = 30;
+            week.begin(uptime);
+            continued = false;
+            resets++;
+            continue;
+        }
+        int co2 = 1000 + (int) (500 * sin(t / 20000.0)) + rand() % 50;
+        if (rand() % 500 == 0) co2 = -1;
+        week.add(uptime, co2, warning, critical);
+        if (co2 <= 0) continue;
+
+        uint32_t now = uptime + week.offset;
+        uint32_t seconds = continued ? std::min(now - last, OperameRollup::max_gap) : 0;
+        for (auto* m : { &hours, &days }) {
+            Expected& e = (*m)[now / (m == &hours ? 3600 : 86400)];
+            e.min = std::min<uint32_t>(e.min, co2);
+            e.max = std::max<uint32_t>(e.max, co2);
+            e.count++;
+            e.sum += co2;
+            if (co2 >= warning) e.warning += seconds;
+            if (co2 >= critical) e.critical += seconds;
+        }
+        last = now;
+        continued = true;
+    }
+    TEST_ASSERT_EQUAL_INT(6, resets);
+
+    for (int ago = 0; ago < week.hours.length; ago++) {
+        const Bucket& b = week.hours.get(ago);
+        check(hours[b.start / 3600], b);
+    }
+    for (int ago = 0; ago < 7; ago++) {
+        const Bucket& b = week.days.get(ago);
+        TEST_ASSERT_TRUE(b.count > 0);
+        check(days[b.start / 86400], b);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, week.days.get(7).count);
+    printf("%d buckets in %u bytes of RTC RAM\n",
+        week.minutes.length + week.hours.length + week.days.length, (unsigned) offsetof(OperameRollup::Rollups, offset));
+}
+
+// In the sensor task after every reading, so it had better be cheap
+void test_add_time() {
+    const int n = 10000000;
+    uint32_t uptime = week.last - week.offset;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) week.add(uptime + i / 2, 500 + (i & 511), 800, 1200);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+    printf("add: %.1f ns\n", ns);
+}
+
+// Every reading in a minute is the same, so a complete bucket that was read
+// while the ring moved on shows up as a wrong min, max or count
+static int minute_co2(uint32_t start) {
+    return 400 + start / 60 % 1000;
+}
+
+static OperameRollup::Ring<60, 60> ring;
+
+void test_read_while_adding() {
+    const uint32_t end = 1u << 30;  // passed as the time of the last reading
+    std::atomic<bool> done { false };
+    memset((void*) &ring, 0, sizeof(ring));
+    for (uint32_t now = 0; now < 3600; now += 10) ring.add(now, minute_co2(now - now % 60), 10, 800, 1200);
+
+    std::thread writer([&] {
+        for (uint32_t now = 3600; now < end - 60; now += 10) {
+            ring.add(now, minute_co2(now - now % 60), 10, 800, 1200);
+            if (now > 3600 + 60 * 1000000) break;
+        }
+        done = true;
+    });
+
+    // Counted rather than asserted, so that a failure does not leave the
+    // writer running
+    int walks = 0, torn = 0, out_of_order = 0;
+    OperameStats::Buffer<2048> out;
+    while (!done) {
+        for (int ago = 1; ago < ring.length; ago++) {
+            Bucket b = ring.read(ago);
+            if (b.count != 6 || b.min != minute_co2(b.start) || b.max != b.min) torn++;
+        }
+
+        // Each minute once, newest first, even when the ring moves on
+        out.clear();
+        OperameRollup::json(out, ring, end);
+        const char* p = out.c_str() + 1;
+        unsigned long age, previous = 0;
+        unsigned min, max;
+        int avg, n = 0;
+        while (sscanf(p, "[%lu,%u,%d,%u]", &age, &min, &avg, &max) == 4) {
+            if (n++ && age != previous + 60) out_of_order++;
+            if ((int) min != minute_co2(end - age) || max != min) torn++;
+            previous = age;
+            p = strchr(p, ']') + 2;
+        }
+        if (!n) torn++;
+        walks++;
+    }
+    writer.join();
+    TEST_ASSERT_EQUAL_INT(0, torn);
+    TEST_ASSERT_EQUAL_INT(0, out_of_order);
+    printf("%d walks while adding\n", walks);
+}
+
+void setUp() { }
+
+void tearDown() { }
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_week_matches_brute_force);
+    RUN_TEST(test_add_time);
+    RUN_TEST(test_read_while_adding);
+    return UNITY_END();
+}
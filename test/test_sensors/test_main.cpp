@@ -0,0 +1,331 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <hal.h>
+#include <operame_sensors.h>
+
+// Replays recorded sensor traffic (see test/traces/) through the drivers and
+// checks that they come up with the readings the firmware printed at the time.
+// The traces come from the emulated sensors, so the quirks of real ones are
+// checked separately, with frames built by hand.
+
+static std::string trace(const char* name) {
+    std::string path = __FILE__;
+    path.erase(path.find_last_of('/') + 1);
+    return path + "../traces/" + name;
+}
+
+// The lines of a trace that are a number, as printed by sensor_poll()
+static std::vector<int> printed(const std::string& path) {
+    std::vector<int> readings;
+    FILE* f = fopen(path.c_str(), "r");
+    TEST_ASSERT_TRUE_MESSAGE(f, path.c_str());
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        char* end;
+        long v = strtol(line, &end, 10);
+        if (end != line && (*end == '\n' || *end == '\0')) readings.push_back(v);
+    }
+    fclose(f);
+    return readings;
+}
+
+struct Latency {
+    unsigned long   samples = 0;
+    unsigned long   ms_total = 0;       // virtual time from request() to a reading
+    unsigned long   ms_max = 0;
+    unsigned long   polls = 0;          // read() calls
+    double          ns_polling = 0;     // host time in read()
+};
+
+// Like the sensor task: a request every 5 s, read() every millisecond
+template <typename Chain>
+static std::vector<int> replay(const char* name, Chain& chain, HardwareSerial& serial, Latency& latency) {
+    static bool done;
+    done = false;
+    hal::replay_sensor(serial, trace(name).c_str(), [] { done = true; });
+
+    std::vector<int> readings;
+    TEST_ASSERT_TRUE(chain.probe());
+    unsigned long next = millis(), requested = 0;
+    while (!done) {
+        if ((long) (millis() - next) >= 0) {
+            chain.request();
+            requested = millis();
+            next += 5000;
+        }
+        int co2;
+        auto start = std::chrono::steady_clock::now();
+        bool got = chain.read(co2);
+        latency.ns_polling += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        latency.polls++;
+        if (got) {
+            readings.push_back(co2);
+            unsigned long ms = millis() - requested;
+            latency.samples++;
+            latency.ms_total += ms;
+            latency.ms_max = std::max(latency.ms_max, ms);
+        }
+        delay(1);
+    }
+    return readings;
+}
+
+static void report(const char* driver, const Latency& l) {
+    printf("%s: %lu readings, request to reading avg %lu max %lu ms, read() %.0f ns per call\n",
+        driver, l.samples, l.samples ? l.ms_total / l.samples : 0, l.ms_max, l.polls ? l.ns_polling / l.polls : 0);
+}
+
+void setUp() { }
+void tearDown() { }
+
+// Probes like the firmware does, so the trace must pick the right driver
+static void check(const char* name, const char* driver) {
+    HardwareSerial serial(2);
+    serial.begin(9600);
+    OperameUART::Transaction transaction(serial);
+    OperameSensors::AQC aqc_driver(transaction, serial);
+    OperameSensors::MHZ mhz_driver(transaction, serial);
+    OperameSensors::Chain<OperameSensors::AQC, OperameSensors::MHZ> chain(aqc_driver, mhz_driver);
+
+    Latency latency;
+    std::vector<int> readings = replay(name, chain, serial, latency);
+    std::vector<int> expected = printed(trace(name));
+    TEST_ASSERT_EQUAL_STRING(driver, chain.name());
+    TEST_ASSERT_EQUAL_INT(expected.size(), readings.size());
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected.data(), readings.data(), expected.size());
+    report(driver, latency);
+}
+
+void test_mhz19_trace() {
+    check("mhz19.txt", "MHZ");
+}
+
+void test_aqc_trace() {
+    check("aqc.txt", "AQC");
+}
+
+// A sensor that answers each command with the next frame queued for it, and
+// nothing once they run out
+struct Device {
+    HardwareSerial                                  serial { 2 };
+    OperameUART::Transaction                        transaction { serial };
+    std::map<uint8_t, std::deque<std::string>>      replies;
+    std::string                                     commands;  // second byte of each
+
+    Device() {
+        serial.begin(9600);
+        serial.device = [this](const uint8_t* buf, size_t size) {
+            if (size != 9) return;
+            commands += (char) buf[2];
+            auto& queue = replies[buf[2]];
+            if (queue.empty()) return;
+            serial.inject((const uint8_t*) queue.front().data(), queue.front().size(), 10);
+            queue.pop_front();
+        };
+    }
+
+    // Queues a 9-byte frame with bytes 2 to 7 from `data`
+    void reply(uint8_t command, uint8_t type, std::vector<uint8_t> data, bool valid = true) {
+        uint8_t frame[9] = { 0xff, type };
+        for (size_t i = 0; i < data.size() && i < 6; i++) frame[2 + i] = data[i];
+        frame[8] = OperameUART::Transaction::checksum(frame) + !valid;
+        replies[command].push_back(std::string((const char*) frame, 9));
+    }
+
+    void reply(uint8_t command, const std::string& bytes) {
+        replies[command].push_back(bytes);
+    }
+};
+
+// One MH-Z19 sample: the 0x85 value, and the 0x86 value if it is asked for
+static void mhz_answers(Device& d, int unlimited, int clamped) {
+    d.reply(0x85, 0x85, { 0, 0, (uint8_t) (unlimited >> 8), (uint8_t) unlimited });
+    d.reply(0x86, 0x86, { (uint8_t) (clamped >> 8), (uint8_t) clamped, 65 });
+}
+
+// read() must never block: no virtual time may pass inside it
+template <typename Driver>
+static int sample(Driver& driver) {
+    driver.request();
+    int co2;
+    for (int ms = 0; ms < 2000; ms++) {
+        unsigned long start = millis();
+        bool got = driver.read(co2);
+        TEST_ASSERT_EQUAL_UINT32(start, millis());
+        if (got) return co2;
+        delay(1);
+    }
+    TEST_FAIL_MESSAGE("no reading");
+    return 0;
+}
+
+static void mhz_with_version(Device& d, OperameSensors::MHZ& mhz, const char* version) {
+    d.reply(0xa0, 0xa0, { (uint8_t) version[0], (uint8_t) version[1], (uint8_t) version[2], (uint8_t) version[3] });
+    mhz.begin();
+}
+
+// The init value is 410, or 436 for firmware 0436, and only counts as such
+// when the 0x85 value is at least 10 above it
+void test_mhz19_init_value() {
+    for (int init : { 410, 436 }) {
+        Device d;
+        OperameSensors::MHZ mhz(d.transaction, d.serial);
+        mhz_with_version(d, mhz, init == 436 ? "0436" : "0443");
+
+        mhz_answers(d, init + 10, init);
+        TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+        TEST_ASSERT_TRUE(mhz.warming_up());
+        mhz_answers(d, init + 9, init);
+        TEST_ASSERT_EQUAL_INT(init + 9, sample(mhz));
+
+        // The other firmware's init value is a plain reading
+        int other = init == 436 ? 410 : 436;
+        mhz_answers(d, other + 10, other);
+        TEST_ASSERT_EQUAL_INT(other + 10, sample(mhz));
+        TEST_ASSERT_FALSE(mhz.warming_up());
+    }
+}
+
+void test_mhz19_above_10000() {
+    Device d;
+    OperameSensors::MHZ mhz(d.transaction, d.serial);
+    mhz_with_version(d, mhz, "0436");
+
+    mhz_answers(d, 10001, 5000);
+    TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+    mhz_answers(d, 5000, 10001);
+    TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+    mhz_answers(d, 10000, 10000);
+    TEST_ASSERT_EQUAL_INT(10000, sample(mhz));
+
+    // Warmed up, so from the 0x85 value alone
+    d.commands.clear();
+    d.reply(0x85, 0x85, { 0, 0, 0x27, 0x12 });  // 10002
+    TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\x85", d.commands.c_str());
+}
+
+void test_mhz19_bad_checksum() {
+    Device d;
+    OperameSensors::MHZ mhz(d.transaction, d.serial);
+    mhz_with_version(d, mhz, "0436");
+
+    for (int attempt = 0; attempt < 3; attempt++) d.reply(0x85, 0x85, { 0, 0, 0x03, 0x20 }, false);
+    TEST_ASSERT_EQUAL_INT(-1, sample(mhz));
+}
+
+// A sensor that restarts by itself reports its init value again; that must
+// not pass as a reading for up to a minute, until the regular check
+void test_mhz19_restart_after_warm_up() {
+    Device d;
+    OperameSensors::MHZ mhz(d.transaction, d.serial);
+    mhz_with_version(d, mhz, "0436");
+
+    mhz_answers(d, 800, 800);
+    TEST_ASSERT_EQUAL_INT(800, sample(mhz));
+    d.commands.clear();
+    d.reply(0x85, 0x85, { 0, 0, 0x03, 0x20 });
+    TEST_ASSERT_EQUAL_INT(800, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\x85", d.commands.c_str());
+
+    // Checked at once, and at every sample while the 0x86 value is 436
+    d.commands.clear();
+    mhz_answers(d, 436, 436);
+    sample(mhz);
+    mhz_answers(d, 446, 436);
+    TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\x85\x86\x85\x86", d.commands.c_str());
+    TEST_ASSERT_TRUE(mhz.warming_up());
+
+    mhz_answers(d, 700, 700);
+    TEST_ASSERT_EQUAL_INT(700, sample(mhz));
+    TEST_ASSERT_FALSE(mhz.warming_up());
+}
+
+// After a failure the version is asked again, from request() and read()
+// rather than by blocking in read()
+void test_mhz19_reinit_after_failure() {
+    Device d;
+    OperameSensors::MHZ mhz(d.transaction, d.serial);
+    mhz_with_version(d, mhz, "0443");
+    mhz_answers(d, 800, 800);
+    TEST_ASSERT_EQUAL_INT(800, sample(mhz));
+
+    d.commands.clear();
+    TEST_ASSERT_EQUAL_INT(-1, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\x85\x85\x85", d.commands.c_str());
+    TEST_ASSERT_TRUE(mhz.warming_up());
+
+    // Replaced by a sensor with firmware 0436
+    d.commands.clear();
+    d.reply(0xa0, 0xa0, { '0', '4', '3', '6' });
+    mhz_answers(d, 446, 436);
+    TEST_ASSERT_EQUAL_INT(0, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\xa0\x85\x86", d.commands.c_str());
+
+    d.commands.clear();
+    mhz_answers(d, 600, 600);
+    TEST_ASSERT_EQUAL_INT(600, sample(mhz));
+    TEST_ASSERT_EQUAL_STRING("\x85\x86", d.commands.c_str());
+}
+
+static void aqc_answers(Device& d, int co2) {
+    d.reply(0xc5, 0x86, { (uint8_t) (co2 >> 8), (uint8_t) co2 });
+}
+
+// 9999 and 400 mean warming up, but only until the first other reading
+void test_aqc_init_values() {
+    Device d;
+    OperameSensors::AQC aqc(d.transaction, d.serial);
+
+    for (int init : { 9999, 400, 9999 }) {
+        aqc_answers(d, init);
+        TEST_ASSERT_EQUAL_INT(0, sample(aqc));
+        TEST_ASSERT_TRUE(aqc.warming_up());
+    }
+    aqc_answers(d, 650);
+    TEST_ASSERT_EQUAL_INT(650, sample(aqc));
+    TEST_ASSERT_FALSE(aqc.warming_up());
+    aqc_answers(d, 400);
+    TEST_ASSERT_EQUAL_INT(400, sample(aqc));
+
+    // A failure starts over
+    TEST_ASSERT_EQUAL_INT(-1, sample(aqc));
+    aqc_answers(d, 400);
+    TEST_ASSERT_EQUAL_INT(0, sample(aqc));
+}
+
+// Bytes in front of a frame, including a stray 0xff, are skipped
+void test_aqc_resync() {
+    Device d;
+    OperameSensors::AQC aqc(d.transaction, d.serial);
+    aqc_answers(d, 700);
+    std::string frame = d.replies[0xc5].back();
+    d.replies[0xc5].clear();
+
+    d.reply(0xc5, std::string("\x12\xff\x34\x00\xff", 5) + frame);
+    TEST_ASSERT_EQUAL_INT(700, sample(aqc));
+    d.reply(0xc5, std::string("\xff\xff\xff", 3) + frame);
+    TEST_ASSERT_EQUAL_INT(700, sample(aqc));
+    TEST_ASSERT_EQUAL_INT(2, d.commands.size());  // without a resend
+}
+
+int main() {
+    hal::simulate();
+    UNITY_BEGIN();
+    RUN_TEST(test_mhz19_trace);
+    RUN_TEST(test_aqc_trace);
+    RUN_TEST(test_mhz19_init_value);
+    RUN_TEST(test_mhz19_above_10000);
+    RUN_TEST(test_mhz19_bad_checksum);
+    RUN_TEST(test_mhz19_restart_after_warm_up);
+    RUN_TEST(test_mhz19_reinit_after_failure);
+    RUN_TEST(test_aqc_init_values);
+    RUN_TEST(test_aqc_resync);
+    return UNITY_END();
+}
@@ -0,0 +1,103 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <SPIFFS.h>
+#include <MQTT.h>
+#include <TFT_eSPI.h>
+#include <WiFi.h>
+#include <unistd.h>
+#include <hal.h>
+#include <operame_scheduler.h>
+
+// Boots the firmware on the virtual clock, as the host runner does with
+// OPERAME_SIMULATE and OPERAME_SCRIPT, and checks the counts of its "summary:"
+// line against bounds, so that extra renders or publishes fail the build
+// instead of waiting for someone to diff the output. The bounds leave a few
+// percent of room; a change that moves a count beyond them on purpose
+// updates them.
+
+void setup();
+void loop();
+extern HardwareSerial hwserial1;
+extern OperameScheduler::Job* render_job;
+
+const unsigned long minutes = 20;
+
+static unsigned long loops;
+
+static void press(unsigned long ms, int pin, unsigned long duration) {
+    hal::at(ms, [pin] { hal::set_pin(pin, LOW); });
+    hal::at(ms + duration, [pin] { hal::set_pin(pin, HIGH); });
+}
+
+// Broker down from 5 to 10 minutes, 1500 ppm from 12 minutes on, and the
+// demo button pressed at 15 minutes for the trend screen
+static void simulate() {
+    hal::simulate();
+    for (auto& level : hal::pin_level) level = HIGH;
+    hal::pin_level[12] = LOW;  // pin_pcb_ok
+    hal::attach_sensor(hwserial1, "mhz");
+    hal::wifi_up = true;
+    hal::broker_up = true;
+
+    hal::at(5 * 60000, [] { hal::broker_up = false; });
+    hal::at(10 * 60000, [] { hal::broker_up = true; });
+    hal::at(12 * 60000, [] { hal::co2_override = 1500; });
+    press(15 * 60000, 0, 100);
+
+    static bool done = false;
+    hal::at(minutes * 60000, [] { done = true; });
+    setup();
+    while (!done) {
+        loop();
+        loops++;
+    }
+    printf("summary: loops=%lu pushes=%lu pixels=%llu publishes=%lu renders=%lu\n",
+        loops, hal::pushes.load(), hal::pixels_pushed.load(), hal::publishes.load(),
+        (unsigned long) render_job->runtime.count());
+}
+
+static void check(const char* name, unsigned long long value, unsigned long long min, unsigned long long max) {
+    char message[96];
+    snprintf(message, sizeof(message), "%s: %llu not in %llu..%llu", name, value, min, max);
+    TEST_ASSERT_TRUE_MESSAGE(value >= min && value <= max, message);
+}
+
+void setUp() { }
+void tearDown() { }
+
+// One per minute while the broker is up, from the first reading at 34 s on,
+// and the five missed during the outage caught up in a single batch; no room,
+// as a single extra publish is what this is meant to catch
+void test_publishes() {
+    check("publishes", hal::publishes.load(), 16, 16);
+}
+
+// The render job every 50 ms from the end of setup() on
+void test_renders() {
+    check("renders", render_job->runtime.count(), minutes * 60 * 20 - 200, minutes * 60 * 20);
+}
+
+// Only what changed on the display is pushed
+void test_pushes() {
+    check("pushes", hal::pushes.load(), 14600, 16100);
+    check("pixels", hal::pixels_pushed.load(), 27600000, 30500000);
+}
+
+int main() {
+    char dir[] = "/tmp/operame-test-XXXXXX";
+    setenv("OPERAME_SPIFFS", mkdtemp(dir), 1);
+    setenv("operame_wifi", "1", 1);
+    setenv("operame_mqtt", "1", 1);
+    simulate();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_publishes);
+    RUN_TEST(test_renders);
+    RUN_TEST(test_pushes);
+    int failures = UNITY_END();
+    SPIFFS.format();
+    rmdir(dir);
+    // The firmware's tasks never end; leave without running destructors
+    fflush(stdout);
+    _exit(failures);
+}
@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <operame_stats.h>
+
+static std::vector<std::string> sent;
+
+static void keep(const char* data, size_t length) {
+    sent.emplace_back(data, length);
+}
+
+void setUp() {
+    sent.clear();
+}
+
+void tearDown() { }
+
+void test_messages_of_whole_lines() {
+    OperameStats::Messages<16> messages(keep);
+    messages.print("first line\nsecond\nthird one\n");
+    messages.print("last");
+    messages.finish();
+
+    TEST_ASSERT_EQUAL_INT(3, sent.size());
+    TEST_ASSERT_EQUAL_STRING("first line\n", sent[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("second\n", sent[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("third one\nlast", sent[2].c_str());
+}
+
+void test_long_line_is_cut() {
+    OperameStats::Messages<8> messages(keep);
+    messages.print("0123456789abcdef\n");
+    messages.finish();
+
+    std::string all;
+    for (auto& m : sent) {
+        TEST_ASSERT_LESS_THAN(8, m.size());
+        all += m;
+    }
+    TEST_ASSERT_EQUAL_STRING("0123456789abcdef\n", all.c_str());
+}
+
+void test_nothing_to_send() {
+    OperameStats::Messages<8> messages(keep);
+    messages.finish();
+    TEST_ASSERT_EQUAL_INT(0, sent.size());
+}
+
+// A report as published on <topic>/stats: nothing lost, every message whole lines
+void test_report_is_complete() {
+    std::string report;
+    for (int i = 0; i < 40; i++) report += "job" + std::to_string(i) + "  1234 runs, late avg 0 max 3 ms, p50 12 p99 340 max 1020 us\n";
+
+    OperameStats::Messages<1536> messages(keep);
+    messages.print(report.c_str());
+    messages.finish();
+
+    std::string all;
+    for (auto& m : sent) {
+        TEST_ASSERT_TRUE(m.back() == '\n');
+        all += m;
+    }
+    TEST_ASSERT_TRUE(sent.size() > 1);
+    TEST_ASSERT_TRUE(all == report);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_messages_of_whole_lines);
+    RUN_TEST(test_long_line_is_cut);
+    RUN_TEST(test_nothing_to_send);
+    RUN_TEST(test_report_is_complete);
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <chrono>
+#include <new>
+#include <operame_template.h>
+
+// Counts every allocation in the program, to check that rendering makes none
+static unsigned long allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+static const OperameTemplate::Values values = { 612, 3600, "operame-123abc", 580, 650, 601 };
+
+static const char* render(const char* text) {
+    static OperameTemplate::Template t;
+    static char buf[128];
+    t.parse(text);
+    t.render(buf, sizeof(buf), values);
+    return buf;
+}
+
+void setUp() { }
+void tearDown() { }
+
+void test_placeholders() {
+    TEST_ASSERT_EQUAL_STRING("612", render("{}"));
+    TEST_ASSERT_EQUAL_STRING("612 PPM", render("{} PPM"));
+    TEST_ASSERT_EQUAL_STRING("operame-123abc up 3600 s: 580/601/650",
+        render("{hostname} up {uptime} s: {min}/{avg}/{max}"));
+    TEST_ASSERT_EQUAL_STRING("{nope} 612 {", render("{nope} {} {"));
+    TEST_ASSERT_EQUAL_STRING("", render(""));
+}
+
+void test_truncation() {
+    OperameTemplate::Template t;
+    char buf[6];
+    t.parse("{} PPM");
+    TEST_ASSERT_EQUAL_INT(5, t.render(buf, sizeof(buf), values));
+    TEST_ASSERT_EQUAL_STRING("612 P", buf);
+}
+
+// Eight placeholders, each after a literal, need 16 segments before the tail
+void test_many_placeholders() {
+    TEST_ASSERT_EQUAL_STRING("a612b612c612d612e612f612g612h{}tail", render("a{}b{}c{}d{}e{}f{}g{}h{}tail"));
+    TEST_ASSERT_EQUAL_STRING("612612612612612612612612612612612612612612{}{}{}",
+        render("{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}"));
+    TEST_ASSERT_EQUAL_STRING("a612b612c612d612e612f612g612h", render("a{}b{}c{}d{}e{}f{}g{}h"));
+}
+
+void test_render_allocates_nothing() {
+    OperameTemplate::Template t;
+    t.parse("{hostname}: {} PPM ({min}-{max}, avg {avg}) after {uptime} s");
+    char buf[128];
+    unsigned long before = allocations;
+    for (int i = 0; i < 1000; i++) t.render(buf, sizeof(buf), values);
+    TEST_ASSERT_EQUAL_INT(0, allocations - before);
+}
+
+// Not a pass/fail check: prints the cost of a render for comparison with the
+// String::replace() chain it replaced
+void test_render_time() {
+    OperameTemplate::Template t;
+    t.parse("{hostname}: {} PPM ({min}-{max}, avg {avg}) after {uptime} s");
+    char buf[128];
+    const int n = 1000000;
+    size_t total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) total += t.render(buf, sizeof(buf), values);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    printf("render: %.1f ns, %lu bytes\n", elapsed.count() / n, (unsigned long) (total / n));
+
+    unsigned long before = allocations;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n / 10; i++) {
+        String s = "{hostname}: {} PPM ({min}-{max}, avg {avg}) after {uptime} s";
+        s.replace("{hostname}", values.hostname);
+        s.replace("{uptime}", String(values.uptime));
+        s.replace("{min}", String(values.min));
+        s.replace("{max}", String(values.max));
+        s.replace("{avg}", String(values.avg));
+        s.replace("{}", String(values.co2));
+        total += s.length();
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    printf("String::replace: %.1f ns, %.1f allocations\n", elapsed.count() / (n / 10), (allocations - before) / (n / 10.0));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_placeholders);
+    RUN_TEST(test_truncation);
+    RUN_TEST(test_many_placeholders);
+    RUN_TEST(test_render_allocates_nothing);
+    RUN_TEST(test_render_time);
+    return UNITY_END();
+}